@@ -280,4 +280,6 @@ if options.wait_gdb:
         cpu.wait_for_remote_gdb = True
 
 root = Root(full_system = False, system = system)
+if options.ruby and options.ruby_event_queues > 1:
+    root.sim_quantum = options.ruby_sim_quantum
 Simulation.run(options, root, system, FutureClass)
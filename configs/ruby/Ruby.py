@@ -89,6 +89,18 @@ def define_options(parser):
     parser.add_option("--recycle-latency", type="int", default=10,
                       help="Recycle latency for ruby controller input buffers")
 
+    # parallel simulation options
+    parser.add_option("--ruby-event-queues", type="int", default=1,
+                      help="Number of event queues (host threads) to spread "
+                           "the Ruby routers and controllers over. Runs on "
+                           "several queues are not deterministic and their "
+                           "timing differs from single-queue runs.")
+    parser.add_option("--ruby-sim-quantum", type="int", default=500,
+                      help="Simulation quantum in ticks when running on "
+                           "several event queues. Must not exceed the "
+                           "shortest network link latency (one cycle at "
+                           "the default 2GHz Ruby clock is 500 ticks).")
+
     protocol = buildEnv['PROTOCOL']
     exec("from . import %s" % protocol)
     eval("%s.define_options(parser)" % protocol)
@@ -126,6 +138,8 @@ def setup_memory_controllers(system, ruby, dir_cntrls, options):
             crossbar = IOXBar()
             crossbars.append(crossbar)
             dir_cntrl.memory = crossbar.slave
+            if options.ruby_event_queues > 1:
+                crossbar.eventq_index = dir_cntrl.eventq_index
 
         dir_ranges = []
         for r in system.mem_ranges:
@@ -146,6 +160,12 @@ def setup_memory_controllers(system, ruby, dir_cntrls, options):
             else:
                 mem_ctrl.port = dir_cntrl.memory
 
+            # The directory talks to its memory through direct port
+            # calls, so both have to run on the same event queue
+            if options.ruby_event_queues > 1:
+                for obj in mem_ctrl.descendants():
+                    obj.eventq_index = dir_cntrl.eventq_index
+
             # Enable low-power DRAM states if option is set
             if issubclass(mem_type, DRAMInterface):
                 mem_ctrl.dram.enable_dram_powerdown = \
@@ -207,6 +227,9 @@ def create_system(options, full_system, system, piobus = None, dma_ports = [],
     # Initialize network based on topology
     Network.init_network(options, network, InterfaceClass)
 
+    if options.ruby_event_queues > 1:
+        partition_event_queues(options, system, network, cpu_sequencers)
+
     # Create a port proxy for connecting the system port. This is
     # independent of the protocol and kept in the protocol-agnostic
     # part (i.e. here).
@@ -242,6 +265,60 @@ def create_system(options, full_system, system, piobus = None, dma_ports = [],
         ruby.phys_mem = SimpleMemory(range=system.mem_ranges[0],
                                      in_addr_map=False)
 
+def partition_event_queues(options, system, network, cpu_sequencers):
+    """Spread the Ruby system over several event queues.
+
+    Routers are dealt out round-robin. Every controller, its network
+    interface and its external link follow the router the controller
+    is attached to, so that only the internal links cross event queues.
+    Their latency provides the lookahead, which is why the simulation
+    quantum must not exceed it. Sequencers call into their CPUs
+    directly, so each CPU is moved to the queue of its sequencer.
+    """
+
+    num_queues = options.ruby_event_queues
+    if options.ruby_sim_quantum <= 0:
+        fatal("--ruby-event-queues needs a positive --ruby-sim-quantum")
+
+    def assign(obj, index):
+        # Children inherit the parent's queue unless they are set
+        # explicitly, so override the whole subtree
+        for child in obj.descendants():
+            child.eventq_index = index
+
+    router_queue = {}
+    for (i, router) in enumerate(network.routers):
+        router_queue[router.router_id] = i % num_queues
+        assign(router, router_queue[router.router_id])
+
+    cntrl_queue = {}
+    for (i, ext_link) in enumerate(network.ext_links):
+        index = router_queue[ext_link.int_node.router_id]
+        assign(ext_link, index)
+        assign(ext_link.ext_node, index)
+        cntrl_queue[id(ext_link.ext_node)] = index
+        if len(network.netifs) > i:
+            assign(network.netifs[i], index)
+
+    # Each direction of an internal link is driven by its source and
+    # drained by its destination. Garnet links carry their flits on a
+    # link object woken up by the upstream router, and credits on one
+    # woken up by the downstream router.
+    for int_link in network.int_links:
+        src_index = router_queue[int_link.src_node.router_id]
+        dst_index = router_queue[int_link.dst_node.router_id]
+        int_link.eventq_index = src_index
+        if hasattr(int_link, 'network_link'):
+            assign(int_link.network_link, src_index)
+            assign(int_link.credit_link, dst_index)
+
+    if hasattr(system, 'cpu'):
+        for (i, cpu_seq) in enumerate(cpu_sequencers):
+            cntrl = cpu_seq.get_parent()
+            if i >= len(system.cpu) or id(cntrl) not in cntrl_queue:
+                continue
+            assign(system.cpu[i], cntrl_queue[id(cntrl)])
+
 def create_directories(options, bootmem, ruby_system, system):
     dir_cntrl_nodes = []
     for i in range(options.num_dirs):
@@ -92,6 +92,14 @@ class BaseCPU : public ::BaseCPU
         return ::BaseCPU::getSendFunctional();
     }
 
+    PortProxy::BulkAccessFunc
+    getBulkAccessFunc() override
+    {
+        if (sendFunctional)
+            return nullptr;
+        return ::BaseCPU::getBulkAccessFunc();
+    }
+
   protected:
     sc_core::sc_module *evs;
 
@@ -0,0 +1,356 @@
+/*
+ * Copyright (c) 2026 The gem5 Authors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "base/binary_ini.hh"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <vector>
+
+#include "base/inifile.hh"
+
+const char BinaryIniFile::magic[8] = { 'g', 'e', 'm', '5', 'i', 'n', 'i', 0 };
+const uint32_t BinaryIniFile::version;
+
+namespace {
+
+const uint32_t byteOrderMark = 0x01020304;
+
+/** Offset of the section hash table in the file. */
+const uint64_t sectionTable = 16;
+
+/** Size of a hash table bucket: a hash and a record offset. */
+const uint64_t bucketSize = 16;
+
+uint64_t
+hashName(const char *name, size_t len)
+{
+    uint64_t hash = 0xcbf29ce484222325ULL;
+    for (size_t i = 0; i < len; i++) {
+        hash ^= (uint8_t)name[i];
+        hash *= 0x100000001b3ULL;
+    }
+    return hash;
+}
+
+uint64_t
+align8(uint64_t offset)
+{
+    return (offset + 7) & ~(uint64_t)7;
+}
+
+/** Number of buckets for a table of n names, at most half full. */
+uint64_t
+tableSize(size_t n)
+{
+    uint64_t buckets = 2;
+    while (buckets < 2 * n)
+        buckets <<= 1;
+    return buckets;
+}
+
+class Writer
+{
+  public:
+    std::vector<uint8_t> buf;
+
+    template <typename T>
+    void
+    put(uint64_t offset, T val)
+    {
+        std::memcpy(&buf[offset], &val, sizeof(val));
+    }
+
+    template <typename T>
+    uint64_t
+    append(T val)
+    {
+        return append(&val, sizeof(val));
+    }
+
+    uint64_t
+    append(const void *data, size_t len)
+    {
+        uint64_t offset = buf.size();
+        buf.insert(buf.end(), (const uint8_t *)data,
+                   (const uint8_t *)data + len);
+        return offset;
+    }
+
+    void
+    align()
+    {
+        buf.resize(align8(buf.size()), 0);
+    }
+
+    /** Append an empty hash table and return the offset of its size. */
+    uint64_t
+    appendTable(uint64_t buckets)
+    {
+        uint64_t offset = append<uint64_t>(buckets);
+        buf.resize(buf.size() + buckets * bucketSize, 0);
+        return offset;
+    }
+
+    /** Insert a record into the hash table at the given offset. */
+    void
+    insert(uint64_t table, const std::string &name, uint64_t record)
+    {
+        uint64_t buckets;
+        std::memcpy(&buckets, &buf[table], sizeof(buckets));
+        uint64_t hash = hashName(name.data(), name.size());
+        for (uint64_t i = 0; ; i++) {
+            uint64_t bucket = table + sizeof(uint64_t) +
+                ((hash + i) & (buckets - 1)) * bucketSize;
+            uint64_t used;
+            std::memcpy(&used, &buf[bucket + 8], sizeof(used));
+            if (!used) {
+                put<uint64_t>(bucket, hash);
+                put<uint64_t>(bucket + 8, record);
+                return;
+            }
+        }
+    }
+};
+
+} // anonymous namespace
+
+BinaryIniFile::BinaryIniFile()
+    : data(nullptr), size(0)
+{
+}
+
+BinaryIniFile::~BinaryIniFile()
+{
+    if (data)
+        munmap(const_cast<uint8_t *>(data), size);
+}
+
+bool
+BinaryIniFile::load(const std::string &file)
+{
+    if (data) {
+        munmap(const_cast<uint8_t *>(data), size);
+        data = nullptr;
+        size = 0;
+    }
+
+    int fd = open(file.c_str(), O_RDONLY);
+    if (fd == -1)
+        return false;
+
+    struct stat st;
+    if (fstat(fd, &st) == -1 || (uint64_t)st.st_size < sectionTable + 8) {
+        close(fd);
+        return false;
+    }
+
+    void *addr = mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (addr == MAP_FAILED)
+        return false;
+
+    data = (const uint8_t *)addr;
+    size = st.st_size;
+
+    if (std::memcmp(data, magic, sizeof(magic)) != 0 ||
+        get<uint32_t>(8) != version || get<uint32_t>(12) != byteOrderMark) {
+        munmap(addr, size);
+        data = nullptr;
+        size = 0;
+        return false;
+    }
+
+    return true;
+}
+
+uint64_t
+BinaryIniFile::lookup(uint64_t table, const std::string &name,
+                      bool is_section) const
+{
+    if (table + sizeof(uint64_t) > size)
+        return 0;
+
+    uint64_t buckets = get<uint64_t>(table);
+    if (!buckets || (buckets & (buckets - 1)) ||
+        buckets > (size - table) / bucketSize) {
+        return 0;
+    }
+
+    uint64_t hash = hashName(name.data(), name.size());
+    for (uint64_t i = 0; i < buckets; i++) {
+        uint64_t bucket = table + sizeof(uint64_t) +
+            ((hash + i) & (buckets - 1)) * bucketSize;
+        uint64_t record = get<uint64_t>(bucket + 8);
+        if (!record || record + 8 > size)
+            return 0;
+        if (get<uint64_t>(bucket) != hash)
+            continue;
+
+        uint64_t len = is_section ? get<uint64_t>(record) :
+            get<uint32_t>(record);
+        if (len == name.size() && record + 8 + len <= size &&
+            std::memcmp(data + record + 8, name.data(), len) == 0) {
+            return record;
+        }
+    }
+    return 0;
+}
+
+uint64_t
+BinaryIniFile::findSection(const std::string &section) const
+{
+    if (!data)
+        return 0;
+    return lookup(sectionTable, section, true);
+}
+
+uint64_t
+BinaryIniFile::findEntry(const std::string &section,
+                         const std::string &entry) const
+{
+    uint64_t record = findSection(section);
+    if (!record)
+        return 0;
+
+    uint64_t table = record + 8 + align8(get<uint64_t>(record));
+    return lookup(table, entry, false);
+}
+
+bool
+BinaryIniFile::find(const std::string &section, const std::string &entry,
+                    std::string &value) const
+{
+    uint64_t record = findEntry(section, entry);
+    if (!record)
+        return false;
+
+    uint32_t key_len = get<uint32_t>(record);
+    uint32_t value_len = get<uint32_t>(record + 4);
+    uint64_t offset = record + 8 + key_len;
+    if (offset + value_len > size)
+        return false;
+
+    value.assign((const char *)data + offset, value_len);
+    return true;
+}
+
+bool
+BinaryIniFile::entryExists(const std::string &section,
+                           const std::string &entry) const
+{
+    return findEntry(section, entry) != 0;
+}
+
+bool
+BinaryIniFile::sectionExists(const std::string &section) const
+{
+    return findSection(section) != 0;
+}
+
+bool
+BinaryIniFile::write(const IniFile &ini, std::ostream &os)
+{
+    // Sort sections and entries to make the output deterministic
+    std::vector<std::string> sections;
+    ini.getSectionNames(sections);
+    std::sort(sections.begin(), sections.end());
+
+    Writer w;
+    w.append(magic, sizeof(magic));
+    w.append<uint32_t>(version);
+    w.append<uint32_t>(byteOrderMark);
+    uint64_t section_table = w.appendTable(tableSize(sections.size()));
+
+    std::vector<std::pair<std::string, std::string>> entries;
+    for (const auto &section : sections) {
+        entries.clear();
+        ini.visitSection(section,
+            [&entries](const std::string &key, const std::string &value) {
+                entries.emplace_back(key, value);
+            });
+        std::sort(entries.begin(), entries.end());
+
+        w.align();
+        uint64_t record = w.append<uint64_t>(section.size());
+        w.append(section.data(), section.size());
+        w.align();
+        uint64_t entry_table = w.appendTable(tableSize(entries.size()));
+        w.insert(section_table, section, record);
+
+        for (const auto &entry : entries) {
+            if (entry.first.size() > UINT32_MAX ||
+                entry.second.size() > UINT32_MAX) {
+                return false;
+            }
+
+            w.align();
+            uint64_t entry_record = w.append<uint32_t>(entry.first.size());
+            w.append<uint32_t>(entry.second.size());
+            w.append(entry.first.data(), entry.first.size());
+            w.append(entry.second.data(), entry.second.size());
+            w.insert(entry_table, entry.first, entry_record);
+        }
+    }
+
+    os.write((const char *)w.buf.data(), w.buf.size());
+    return (bool)os;
+}
+
+bool
+BinaryIniFile::convert(const std::string &ini_file,
+                       const std::string &binary_file)
+{
+    IniFile ini;
+    if (!ini.load(ini_file))
+        return false;
+
+    // Write a temporary file next to the binary file and rename it over
+    // the binary file once complete. A failed conversion then never
+    // leaves a partial binary file, which would look newer than the
+    // checkpoint and be preferred to it.
+    std::string tmp_file = binary_file + ".tmp";
+    std::ofstream os(tmp_file, std::ios::out | std::ios::binary);
+    if (!os)
+        return false;
+
+    bool success = write(ini, os);
+    os.close();
+    if (!success || !os ||
+        std::rename(tmp_file.c_str(), binary_file.c_str()) != 0) {
+        unlink(tmp_file.c_str());
+        return false;
+    }
+    return true;
+}
@@ -0,0 +1,138 @@
+/*
+ * Copyright (c) 2026 The gem5 Authors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __BASE_BINARY_INI_HH__
+#define __BASE_BINARY_INI_HH__
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <ostream>
+#include <string>
+
+class IniFile;
+
+/**
+ * @file
+ * An indexed, binary form of an IniFile.
+ *
+ * Loading an IniFile parses the whole file and builds a hash table of
+ * hash tables of strings, which dominates the time it takes to restore
+ * a checkpoint of a large system. A BinaryIniFile is mapped into
+ * memory instead and looked up in place. The file contains a hash
+ * table of sections, and each section a hash table of its entries:
+ *
+ * header:  char magic[8], uint32_t version, uint32_t byte order mark,
+ *          uint64_t bucket count, buckets
+ * section: uint64_t name length, name, uint64_t bucket count, buckets
+ * entry:   uint32_t key length, uint32_t value length, key, value
+ * bucket:  uint64_t name hash, uint64_t record offset (0 if unused)
+ *
+ * Records are 8 byte aligned and names are hashed with 64 bit FNV-1a,
+ * so files don't depend on the host they were created on beyond its
+ * byte order. Values are stored as they appear in the .ini file.
+ */
+class BinaryIniFile
+{
+  public:
+    static const char magic[8];
+    static const uint32_t version = 1;
+
+    BinaryIniFile();
+    ~BinaryIniFile();
+
+    /**
+     * Map a binary .ini file into memory.
+     *
+     * @param file The path of the file to load.
+     * @return True if successful, false if the file couldn't be mapped
+     *         or isn't a binary .ini file.
+     */
+    bool load(const std::string &file);
+
+    /**
+     * Find the value of an entry.
+     *
+     * @return True if found, false if not.
+     */
+    bool find(const std::string &section, const std::string &entry,
+              std::string &value) const;
+
+    /** Determine whether an entry exists within the named section. */
+    bool entryExists(const std::string &section,
+                     const std::string &entry) const;
+
+    /** Determine whether the named section exists. */
+    bool sectionExists(const std::string &section) const;
+
+    /**
+     * Write the contents of an IniFile in binary form.
+     *
+     * @return True if successful, false if writing failed.
+     */
+    static bool write(const IniFile &ini, std::ostream &os);
+
+    /**
+     * Convert a .ini file into a binary .ini file. The binary file is
+     * replaced atomically, and left untouched if the conversion fails.
+     *
+     * @return True if successful, false if the conversion failed.
+     */
+    static bool convert(const std::string &ini_file,
+                        const std::string &binary_file);
+
+  private:
+    const uint8_t *data;
+    size_t size;
+
+    /**
+     * Look up a name in a hash table starting at the given offset.
+     *
+     * @return The offset of the record of the name, or 0 if not found.
+     */
+    uint64_t lookup(uint64_t table, const std::string &name,
+                    bool is_section) const;
+
+    /** Find the offset of a section record, or 0 if not found. */
+    uint64_t findSection(const std::string &section) const;
+
+    /** Find the offset of an entry record, or 0 if not found. */
+    uint64_t findEntry(const std::string &section,
+                       const std::string &entry) const;
+
+    template <typename T>
+    T
+    get(uint64_t offset) const
+    {
+        T val;
+        std::memcpy(&val, data + offset, sizeof(val));
+        return val;
+    }
+};
+
+#endif // __BASE_BINARY_INI_HH__
@@ -0,0 +1,244 @@
+/*
+ * Copyright (c) 2026 The gem5 Authors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#include <unistd.h>
+
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+#include "base/binary_ini.hh"
+#include "base/inifile.hh"
+
+namespace {
+
+const char *iniContents = R"ini_file(
+[General]
+   Test1=BARasdf
+   Test2=bar
+
+[Junk]
+Test3=yo
+Test4=mama
+
+[Foo]
+Foo1=89
+Foo2=384
+Empty=
+
+[General]
+Test3=89
+
+[Junk]
+Test4+=mia
+
+[Empty]
+)ini_file";
+
+/** Write the test .ini file in binary form to a temporary file. */
+class BinaryIniTest : public testing::Test
+{
+  protected:
+    std::string filename;
+    BinaryIniFile db;
+
+    void
+    SetUp() override
+    {
+        char name[] = "/tmp/binary_ini.test.XXXXXX";
+        int fd = mkstemp(name);
+        ASSERT_NE(fd, -1);
+        close(fd);
+        filename = name;
+
+        IniFile ini;
+        std::istringstream is(iniContents);
+        ASSERT_TRUE(ini.load(is));
+
+        std::ofstream os(filename, std::ios::out | std::ios::binary);
+        ASSERT_TRUE(BinaryIniFile::write(ini, os));
+        os.close();
+
+        ASSERT_TRUE(db.load(filename));
+    }
+
+    void
+    TearDown() override
+    {
+        std::remove(filename.c_str());
+    }
+};
+
+} // anonymous namespace
+
+TEST_F(BinaryIniTest, MatchFound)
+{
+    std::string value;
+
+    ASSERT_TRUE(db.find("General", "Test2", value));
+    ASSERT_EQ(value, "bar");
+
+    ASSERT_TRUE(db.find("Junk", "Test3", value));
+    ASSERT_EQ(value, "yo");
+
+    ASSERT_TRUE(db.find("Junk", "Test4", value));
+    ASSERT_EQ(value, "mama mia");
+
+    ASSERT_TRUE(db.find("General", "Test1", value));
+    ASSERT_EQ(value, "BARasdf");
+
+    ASSERT_TRUE(db.find("General", "Test3", value));
+    ASSERT_EQ(value, "89");
+
+    ASSERT_TRUE(db.find("Foo", "Empty", value));
+    ASSERT_EQ(value, "");
+}
+
+TEST_F(BinaryIniTest, MatchNotFound)
+{
+    std::string value;
+
+    ASSERT_FALSE(db.find("Junk2", "test3", value));
+    ASSERT_FALSE(db.find("Junk", "test4", value));
+    ASSERT_FALSE(db.find("Empty", "Test1", value));
+}
+
+TEST_F(BinaryIniTest, Exists)
+{
+    ASSERT_TRUE(db.sectionExists("General"));
+    ASSERT_TRUE(db.sectionExists("Empty"));
+    ASSERT_FALSE(db.sectionExists("general"));
+
+    ASSERT_TRUE(db.entryExists("Foo", "Foo1"));
+    ASSERT_FALSE(db.entryExists("Foo", "Foo3"));
+    ASSERT_FALSE(db.entryExists("Bar", "Foo1"));
+}
+
+TEST_F(BinaryIniTest, LoadText)
+{
+    std::ofstream os(filename);
+    os << iniContents;
+    os.close();
+
+    BinaryIniFile text;
+    ASSERT_FALSE(text.load(filename));
+}
+
+TEST_F(BinaryIniTest, Convert)
+{
+    char name[] = "/tmp/binary_ini.test.XXXXXX";
+    int fd = mkstemp(name);
+    ASSERT_NE(fd, -1);
+    close(fd);
+    std::string ini_filename = name;
+
+    std::ofstream os(ini_filename);
+    os << iniContents;
+    os.close();
+
+    // The converted file replaces the previous binary file
+    ASSERT_TRUE(BinaryIniFile::convert(ini_filename, filename));
+    ASSERT_NE(access((filename + ".tmp").c_str(), F_OK), 0);
+
+    BinaryIniFile converted;
+    ASSERT_TRUE(converted.load(filename));
+    std::string value;
+    ASSERT_TRUE(converted.find("Junk", "Test4", value));
+    ASSERT_EQ(value, "mama mia");
+
+    // A failed conversion leaves the binary file untouched
+    std::remove(ini_filename.c_str());
+    ASSERT_FALSE(BinaryIniFile::convert(ini_filename, filename));
+    ASSERT_TRUE(converted.load(filename));
+    ASSERT_NE(access((filename + ".tmp").c_str(), F_OK), 0);
+}
+
+TEST_F(BinaryIniTest, ConvertFailedRename)
+{
+    char ini_name[] = "/tmp/binary_ini.test.XXXXXX";
+    int fd = mkstemp(ini_name);
+    ASSERT_NE(fd, -1);
+    close(fd);
+
+    std::ofstream os(ini_name);
+    os << iniContents;
+    os.close();
+
+    // A file can't be renamed over a directory, so the temporary file
+    // must be removed once written
+    char dir_name[] = "/tmp/binary_ini.test.XXXXXX";
+    ASSERT_NE(mkdtemp(dir_name), nullptr);
+    std::string dirname = dir_name;
+
+    ASSERT_FALSE(BinaryIniFile::convert(ini_name, dirname));
+    ASSERT_NE(access((dirname + ".tmp").c_str(), F_OK), 0);
+
+    rmdir(dir_name);
+    std::remove(ini_name);
+}
+
+TEST(BinaryIniLargeTest, ManyEntries)
+{
+    std::ostringstream contents;
+    for (int s = 0; s < 100; s++) {
+        contents << "[system.cpu" << s << "]\n";
+        for (int e = 0; e < 100; e++)
+            contents << "entry" << e << "=" << s * e << "\n";
+    }
+
+    IniFile ini;
+    std::istringstream is(contents.str());
+    ASSERT_TRUE(ini.load(is));
+
+    char name[] = "/tmp/binary_ini.test.XXXXXX";
+    int fd = mkstemp(name);
+    ASSERT_NE(fd, -1);
+    close(fd);
+
+    std::ofstream os(name, std::ios::out | std::ios::binary);
+    ASSERT_TRUE(BinaryIniFile::write(ini, os));
+    os.close();
+
+    BinaryIniFile db;
+    ASSERT_TRUE(db.load(name));
+
+    std::string value;
+    for (int s = 0; s < 100; s++) {
+        std::string section = "system.cpu" + std::to_string(s);
+        for (int e = 0; e < 100; e++) {
+            ASSERT_TRUE(db.find(section, "entry" + std::to_string(e), value));
+            ASSERT_EQ(value, std::to_string(s * e));
+        }
+        ASSERT_FALSE(db.entryExists(section, "entry100"));
+    }
+
+    std::remove(name);
+}
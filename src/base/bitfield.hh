@@ -251,9 +251,12 @@ findMsbSet(uint64_t val) {
  */
 inline int
 findLsbSet(uint64_t val) {
-    int lsb = 0;
     if (!val)
         return sizeof(val) * 8;
+#if defined(__GNUC__)
+    return __builtin_ctzll(val);
+#else
+    int lsb = 0;
     if (!bits(val, 31,0)) { lsb += 32; val >>= 32; }
     if (!bits(val, 15,0)) { lsb += 16; val >>= 16; }
     if (!bits(val, 7,0))  { lsb += 8;  val >>= 8;  }
@@ -261,6 +264,7 @@ findLsbSet(uint64_t val) {
     if (!bits(val, 1,0))  { lsb += 2;  val >>= 2;  }
     if (!bits(val, 0,0))  { lsb += 1; }
     return lsb;
+#endif
 }
 
 /**
@@ -283,10 +287,7 @@ isPow2(T v) {
  */
 inline int
 popCount(uint64_t val) {
-#ifndef __has_builtin
-    #define __has_builtin(foo) 0
-#endif
-#if defined(__GNUC__) || (defined(__clang__) && __has_builtin(__builtin_popcountl))
+#if defined(__GNUC__)
     return __builtin_popcountl(val);
 #else
     const uint64_t m1 = 0x5555555555555555;  // ..010101b
@@ -298,7 +299,7 @@ popCount(uint64_t val) {
     val = (val & m2) + ((val >> 2) & m2); // 4 bits count -> 4 bits
     val = (val + (val >> 4)) & m4;        // 8 bits count -> 8 bits
     return (val * sum) >> 56;             // horizontal sum
-#endif // defined(__GNUC__) || (defined(__clang__) && __has_builtin(__builtin_popcountl))
+#endif // defined(__GNUC__)
 }
 
 /**
@@ -299,6 +299,15 @@ IniFile::getSectionNames(vector<string> &list) const
     }
 }
 
+void
+IniFile::visitSection(const string &sectionName,
+                      VisitSectionCallback cb) const
+{
+    Section *section = findSection(sectionName);
+    if (section)
+        section->visit(cb);
+}
+
 bool
 IniFile::printUnreferenced()
 {
@@ -337,6 +346,15 @@ IniFile::Section::dump(const string &sectionName)
     }
 }
 
+void
+IniFile::Section::visit(const std::function<void(const std::string &,
+                                                 const std::string &)> &cb)
+    const
+{
+    for (const auto &kv : table)
+        cb(kv.first, kv.second->getValue());
+}
+
 void
 IniFile::dump()
 {
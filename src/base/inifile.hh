@@ -30,6 +30,7 @@
 #define __INIFILE_HH__
 
 #include <fstream>
+#include <functional>
 #include <list>
 #include <string>
 #include <unordered_map>
@@ -132,6 +133,10 @@ class IniFile
 
         /// Print the contents of this section to cout (for debugging).
         void dump(const std::string &sectionName);
+
+        /// Call a function for every entry in this section.
+        void visit(const std::function<void(const std::string &,
+                                            const std::string &)> &cb) const;
     };
 
     /// SectionTable type.  Map of strings to Section object pointers.
@@ -197,6 +202,15 @@ class IniFile
     /// Push all section names into the given vector
     void getSectionNames(std::vector<std::string> &list) const;
 
+    /// Callback for visitSection(), called with the name and value of
+    /// an entry.
+    typedef std::function<void(const std::string &, const std::string &)>
+        VisitSectionCallback;
+
+    /// Call a function for every entry in the named section.
+    void visitSection(const std::string &sectionName,
+                      VisitSectionCallback cb) const;
+
     /// Print unreferenced entries in object.  Iteratively calls
     /// printUnreferend() on all the constituent sections.
     bool printUnreferenced();
@@ -0,0 +1,380 @@
+/*
+ * Copyright (c) 2026 The gem5 Authors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __BASE_OPEN_HASH_MAP_HH__
+#define __BASE_OPEN_HASH_MAP_HH__
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+#include "base/intmath.hh"
+
+/**
+ * A hash map implemented as a flat, open-addressed table with linear
+ * probing. The table is allocated upfront for an expected number of
+ * entries, so that insertions and removals do not touch the heap as long
+ * as this number is not exceeded; if it is, the table doubles in size.
+ *
+ * It is meant to replace node-based maps (e.g., std::unordered_map) in hot
+ * paths where entries are short-lived, such as tables of outstanding
+ * requests. Its interface mimics the subset of std::unordered_map
+ * commonly used for such tables.
+ *
+ * Removal uses backward-shift deletion, so no tombstones are left behind.
+ * As a consequence, an insertion or a removal invalidates all iterators.
+ *
+ * @tparam Key Type of the keys. Must be default-constructible.
+ * @tparam T Type of the mapped values. Must be default-constructible.
+ * @tparam Hash Hash function of the keys.
+ * @tparam KeyEqual Equality function of the keys.
+ */
+template <class Key, class T, class Hash = std::hash<Key>,
+          class KeyEqual = std::equal_to<Key>>
+class OpenHashMap
+{
+  public:
+    typedef Key key_type;
+    typedef T mapped_type;
+    typedef std::pair<Key, T> value_type;
+    typedef std::size_t size_type;
+
+  private:
+    struct Slot
+    {
+        value_type entry;
+        bool used = false;
+    };
+
+    std::vector<Slot> slots;
+
+    /** Number of valid entries. */
+    size_type numEntries;
+
+    /** Number of bits of the hash used to index the table. */
+    int indexBits;
+
+    Hash hasher;
+    KeyEqual keyEqual;
+
+    /** Minimum number of slots in the table. */
+    static constexpr size_type MinCapacity = 8;
+
+    size_type mask() const { return slots.size() - 1; }
+
+    /**
+     * Get the preferred slot of a key. The hash is scrambled with a
+     * multiplicative (Fibonacci) hash, since common hash functions, such as
+     * the identity used for pointers, leave the lowest bits unused.
+     */
+    size_type
+    homeSlot(const Key& key) const
+    {
+        const uint64_t hash =
+            static_cast<uint64_t>(hasher(key)) * 0x9E3779B97F4A7C15ULL;
+        return hash >> (64 - indexBits);
+    }
+
+    /**
+     * Find the slot holding a key, or the empty slot where it would be
+     * inserted.
+     */
+    size_type
+    probe(const Key& key) const
+    {
+        size_type idx = homeSlot(key);
+        while (slots[idx].used && !keyEqual(slots[idx].entry.first, key)) {
+            idx = (idx + 1) & mask();
+        }
+        return idx;
+    }
+
+    /** Resize the table to the given (power of two) number of slots. */
+    void
+    rehash(size_type num_slots)
+    {
+        assert(isPowerOf2(num_slots));
+        std::vector<Slot> old_slots(num_slots);
+        slots.swap(old_slots);
+        indexBits = floorLog2(num_slots);
+        for (auto& slot : old_slots) {
+            if (slot.used) {
+                Slot& new_slot = slots[probe(slot.entry.first)];
+                new_slot.entry = std::move(slot.entry);
+                new_slot.used = true;
+            }
+        }
+    }
+
+    /** Remove the entry of the given slot, shifting back its successors. */
+    void
+    eraseSlot(size_type hole)
+    {
+        assert(slots[hole].used);
+        size_type idx = hole;
+        while (true) {
+            idx = (idx + 1) & mask();
+            if (!slots[idx].used) {
+                break;
+            }
+
+            // An entry can fill the hole only if its home slot is not
+            // (cyclically) located in the range (hole, idx]
+            const size_type home = homeSlot(slots[idx].entry.first);
+            const bool stays = (hole <= idx) ?
+                ((hole < home) && (home <= idx)) :
+                ((hole < home) || (home <= idx));
+            if (!stays) {
+                slots[hole].entry = std::move(slots[idx].entry);
+                hole = idx;
+            }
+        }
+        slots[hole].entry = value_type();
+        slots[hole].used = false;
+        numEntries--;
+    }
+
+  public:
+    /** Forward iterator over the valid entries of the table. */
+    template <class MapType, class EntryType>
+    class IteratorBase
+    {
+      private:
+        friend class OpenHashMap;
+
+        MapType* map;
+        size_type idx;
+
+        void
+        skipUnused()
+        {
+            while ((idx < map->slots.size()) && !map->slots[idx].used) {
+                idx++;
+            }
+        }
+
+      public:
+        typedef std::forward_iterator_tag iterator_category;
+        typedef EntryType value_type;
+        typedef std::ptrdiff_t difference_type;
+        typedef EntryType* pointer;
+        typedef EntryType& reference;
+
+        IteratorBase(MapType* _map, size_type _idx) : map(_map), idx(_idx)
+        {
+            skipUnused();
+        }
+
+        /** Allow the conversion of iterators to const iterators. */
+        template <class OtherMapType, class OtherEntryType>
+        IteratorBase(const IteratorBase<OtherMapType, OtherEntryType>& other)
+          : map(other.map), idx(other.idx)
+        {
+        }
+
+        reference operator*() const { return map->slots[idx].entry; }
+        pointer operator->() const { return &map->slots[idx].entry; }
+
+        IteratorBase&
+        operator++()
+        {
+            idx++;
+            skipUnused();
+            return *this;
+        }
+
+        IteratorBase
+        operator++(int)
+        {
+            IteratorBase it = *this;
+            ++(*this);
+            return it;
+        }
+
+        bool
+        operator==(const IteratorBase& other) const
+        {
+            return (map == other.map) && (idx == other.idx);
+        }
+
+        bool
+        operator!=(const IteratorBase& other) const
+        {
+            return !(*this == other);
+        }
+
+        template <class, class>
+        friend class IteratorBase;
+    };
+
+    typedef IteratorBase<OpenHashMap, value_type> iterator;
+    typedef IteratorBase<const OpenHashMap, const value_type> const_iterator;
+
+    /**
+     * Create a table able to hold the given number of entries without
+     * growing.
+     *
+     * @param expected_size Expected maximum number of entries.
+     */
+    explicit OpenHashMap(size_type expected_size = MinCapacity / 2)
+      : numEntries(0), indexBits(0)
+    {
+        size_type num_slots = MinCapacity;
+        while (num_slots < 2 * expected_size) {
+            num_slots *= 2;
+        }
+        rehash(num_slots);
+    }
+
+    iterator begin() { return iterator(this, 0); }
+    iterator end() { return iterator(this, slots.size()); }
+    const_iterator begin() const { return const_iterator(this, 0); }
+    const_iterator end() const { return const_iterator(this, slots.size()); }
+
+    /** Number of valid entries. */
+    size_type size() const { return numEntries; }
+    bool empty() const { return numEntries == 0; }
+
+    /** Number of entries the table holds before growing. */
+    size_type capacity() const { return slots.size() / 2; }
+
+    iterator
+    find(const Key& key)
+    {
+        const size_type idx = probe(key);
+        return slots[idx].used ? iterator(this, idx) : end();
+    }
+
+    const_iterator
+    find(const Key& key) const
+    {
+        const size_type idx = probe(key);
+        return slots[idx].used ? const_iterator(this, idx) : end();
+    }
+
+    size_type count(const Key& key) const { return slots[probe(key)].used; }
+
+    /**
+     * Insert an entry if its key is not in the table yet.
+     *
+     * @return An iterator to the entry with the key, and whether the
+     *         insertion took place.
+     */
+    std::pair<iterator, bool>
+    emplace(const Key& key, const T& value)
+    {
+        size_type idx = probe(key);
+        if (slots[idx].used) {
+            return std::make_pair(iterator(this, idx), false);
+        }
+
+        // Keep the load factor under 1/2, so that probe sequences are short
+        if (numEntries >= capacity()) {
+            rehash(2 * slots.size());
+            idx = probe(key);
+        }
+        slots[idx].entry = value_type(key, value);
+        slots[idx].used = true;
+        numEntries++;
+        return std::make_pair(iterator(this, idx), true);
+    }
+
+    T&
+    operator[](const Key& key)
+    {
+        return emplace(key, T()).first->second;
+    }
+
+    void
+    erase(const_iterator it)
+    {
+        assert(it.map == this);
+        eraseSlot(it.idx);
+    }
+
+    size_type
+    erase(const Key& key)
+    {
+        const size_type idx = probe(key);
+        if (!slots[idx].used) {
+            return 0;
+        }
+        eraseSlot(idx);
+        return 1;
+    }
+
+    /** Remove all entries, keeping the table allocated. */
+    void
+    clear()
+    {
+        for (auto& slot : slots) {
+            slot.entry = value_type();
+            slot.used = false;
+        }
+        numEntries = 0;
+    }
+};
+
+/**
+ * A set implemented on top of an open-addressed hash table. @see OpenHashMap
+ */
+template <class Key, class Hash = std::hash<Key>,
+          class KeyEqual = std::equal_to<Key>>
+class OpenHashSet
+{
+  private:
+    /** Placeholder for the mapped values. */
+    struct Empty {};
+
+    typedef OpenHashMap<Key, Empty, Hash, KeyEqual> Map;
+    Map map;
+
+  public:
+    typedef typename Map::size_type size_type;
+
+    explicit OpenHashSet(size_type expected_size = 4) : map(expected_size) {}
+
+    size_type size() const { return map.size(); }
+    bool empty() const { return map.empty(); }
+    size_type capacity() const { return map.capacity(); }
+    size_type count(const Key& key) const { return map.count(key); }
+
+    /** @return Whether the key was inserted. */
+    bool insert(const Key& key) { return map.emplace(key, Empty()).second; }
+
+    /** @return Number of keys removed (0 or 1). */
+    size_type erase(const Key& key) { return map.erase(key); }
+
+    void clear() { map.clear(); }
+};
+
+#endif // __BASE_OPEN_HASH_MAP_HH__
@@ -0,0 +1,160 @@
+/*
+ * Copyright (c) 2026 The gem5 Authors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <random>
+#include <unordered_map>
+
+#include "base/open_hash_map.hh"
+
+/** A new table is empty and has at least the requested capacity. */
+TEST(OpenHashMapTest, Empty)
+{
+    OpenHashMap<uint64_t, int> map(100);
+
+    ASSERT_TRUE(map.empty());
+    ASSERT_EQ(map.size(), 0);
+    ASSERT_GE(map.capacity(), 100);
+    ASSERT_TRUE(map.begin() == map.end());
+    ASSERT_TRUE(map.find(0) == map.end());
+}
+
+/** Entries can be inserted, found and erased. */
+TEST(OpenHashMapTest, InsertFindErase)
+{
+    OpenHashMap<uint64_t, int> map;
+
+    auto ret = map.emplace(42, 1);
+    ASSERT_TRUE(ret.second);
+    ASSERT_EQ(ret.first->first, 42);
+    ASSERT_EQ(ret.first->second, 1);
+
+    // A second insertion of the same key does not overwrite it
+    ret = map.emplace(42, 2);
+    ASSERT_FALSE(ret.second);
+    ASSERT_EQ(ret.first->second, 1);
+    ASSERT_EQ(map.size(), 1);
+
+    map[7] = 3;
+    ASSERT_EQ(map.size(), 2);
+    ASSERT_EQ(map.count(7), 1);
+    ASSERT_EQ(map.find(7)->second, 3);
+
+    map.erase(map.find(42));
+    ASSERT_EQ(map.size(), 1);
+    ASSERT_TRUE(map.find(42) == map.end());
+    ASSERT_EQ(map.erase(42), 0);
+    ASSERT_EQ(map.erase(7), 1);
+    ASSERT_TRUE(map.empty());
+}
+
+/** The table grows when the expected size is exceeded. */
+TEST(OpenHashMapTest, Grow)
+{
+    OpenHashMap<uint64_t, uint64_t> map(4);
+    const auto initial_capacity = map.capacity();
+
+    for (uint64_t i = 0; i < 10 * initial_capacity; i++) {
+        map.emplace(i, i * 2);
+    }
+    ASSERT_GT(map.capacity(), initial_capacity);
+    ASSERT_EQ(map.size(), 10 * initial_capacity);
+    for (uint64_t i = 0; i < 10 * initial_capacity; i++) {
+        ASSERT_EQ(map.find(i)->second, i * 2);
+    }
+}
+
+/** Iteration visits every entry exactly once. */
+TEST(OpenHashMapTest, Iterate)
+{
+    OpenHashMap<uint64_t, uint64_t> map;
+    for (uint64_t i = 1; i <= 10; i++) {
+        map[i * 64] = i;
+    }
+
+    uint64_t sum = 0;
+    for (const auto& entry : map) {
+        ASSERT_EQ(entry.first, entry.second * 64);
+        sum += entry.second;
+    }
+    ASSERT_EQ(sum, 55);
+}
+
+/** Erasing entries never loses the remaining ones. */
+TEST(OpenHashMapTest, RandomizedAgainstUnorderedMap)
+{
+    OpenHashMap<uint64_t, uint64_t> map(16);
+    std::unordered_map<uint64_t, uint64_t> ref;
+    std::mt19937_64 rng(0);
+
+    for (int i = 0; i < 100000; i++) {
+        // Use few distinct, aligned keys to stress collisions
+        const uint64_t key = (rng() % 64) * 64;
+        if (rng() % 2) {
+            const auto ret = map.emplace(key, i);
+            ASSERT_EQ(ret.second, ref.emplace(key, i).second);
+        } else {
+            ASSERT_EQ(map.erase(key), ref.erase(key));
+        }
+        ASSERT_EQ(map.size(), ref.size());
+    }
+
+    for (const auto& entry : ref) {
+        const auto it = map.find(entry.first);
+        ASSERT_TRUE(it != map.end());
+        ASSERT_EQ(it->second, entry.second);
+    }
+}
+
+/** Erased entries release their contents. */
+TEST(OpenHashMapTest, EraseReleases)
+{
+    OpenHashMap<std::shared_ptr<int>, int> map;
+    auto ptr = std::make_shared<int>(0);
+
+    map.emplace(ptr, 1);
+    ASSERT_EQ(ptr.use_count(), 2);
+    map.erase(ptr);
+    ASSERT_EQ(ptr.use_count(), 1);
+}
+
+/** Basic set operations. */
+TEST(OpenHashSetTest, InsertErase)
+{
+    OpenHashSet<uint64_t> set;
+
+    ASSERT_TRUE(set.insert(3));
+    ASSERT_FALSE(set.insert(3));
+    ASSERT_EQ(set.count(3), 1);
+    ASSERT_EQ(set.count(4), 0);
+    ASSERT_EQ(set.size(), 1);
+    ASSERT_EQ(set.erase(3), 1);
+    ASSERT_TRUE(set.empty());
+}
@@ -164,6 +164,11 @@ Info::Info()
         Debug::breakpoint();
 }
 
+Info::Info(int _id)
+    : flags(none), precision(-1), prereq(0), id(_id), storageParams(NULL)
+{
+}
+
 Info::~Info()
 {
 }
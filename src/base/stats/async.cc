@@ -0,0 +1,489 @@
+/*
+ * Copyright (c) 2026 The gem5 Authors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "base/stats/async.hh"
+
+#include <algorithm>
+
+#include "base/logging.hh"
+#include "base/stats/info.hh"
+#include "sim/core.hh"
+#include "sim/eventq.hh"
+
+namespace Stats {
+
+namespace {
+
+/**
+ * Stand-in prerequisite for copies of stats whose prerequisite was
+ * zero when the snapshot was taken.
+ */
+class ZeroInfo : public ScalarInfo
+{
+  public:
+    bool check() const override { return true; }
+    void prepare() override {}
+    void reset() override {}
+    bool zero() const override { return true; }
+    void visit(Output &visitor) override {}
+
+    Counter value() const override { return 0; }
+    Result result() const override { return 0; }
+    Result total() const override { return 0; }
+};
+
+const Info *
+zeroInfo()
+{
+    // Created on first use so that it doesn't shift the ids of the
+    // stats created before it.
+    static ZeroInfo info;
+    return &info;
+}
+
+/**
+ * Common part of the stat copies stored in a snapshot. The
+ * description of the stat is copied once, on construction, while
+ * update() refreshes the values on every dump. A copy has the id of
+ * the stat it copies, so that outputs can match it with the copies
+ * of the previous dumps.
+ */
+template <class Base>
+class InfoCopy : public Base
+{
+  public:
+    InfoCopy(const Info &orig)
+        : Base(orig.id)
+    {
+        this->name = orig.name;
+        this->desc = orig.desc;
+        this->flags = orig.flags;
+        this->precision = orig.precision;
+        this->storageParams = orig.storageParams;
+    }
+
+    bool check() const override { return true; }
+    void prepare() override {}
+    void reset() override {}
+    void visit(Output &visitor) override { visitor.visit(*this); }
+
+  protected:
+    void
+    updatePrereq(const Info &orig)
+    {
+        this->prereq =
+            orig.prereq && orig.prereq->zero() ? zeroInfo() : nullptr;
+    }
+};
+
+template <class Base>
+bool
+allZero(const Base &values)
+{
+    return std::all_of(values.begin(), values.end(),
+                       [](typename Base::value_type v) { return v == 0; });
+}
+
+class ScalarCopy : public InfoCopy<ScalarInfo>
+{
+  public:
+    ScalarCopy(const ScalarInfo &orig) : InfoCopy(orig) {}
+
+    void
+    update(const ScalarInfo &orig)
+    {
+        updatePrereq(orig);
+        _value = orig.value();
+        _result = orig.result();
+        _total = orig.total();
+    }
+
+    bool zero() const override { return _value == 0; }
+    Counter value() const override { return _value; }
+    Result result() const override { return _result; }
+    Result total() const override { return _total; }
+
+  private:
+    Counter _value;
+    Result _result;
+    Result _total;
+};
+
+template <class Base>
+class VectorCopyBase : public InfoCopy<Base>
+{
+  public:
+    VectorCopyBase(const VectorInfo &orig)
+        : InfoCopy<Base>(orig)
+    {
+        this->subnames = orig.subnames;
+        this->subdescs = orig.subdescs;
+    }
+
+    void
+    update(const VectorInfo &orig)
+    {
+        this->updatePrereq(orig);
+        _value = orig.value();
+        _result = orig.result();
+        _total = orig.total();
+    }
+
+    bool zero() const override { return allZero(_value); }
+    size_type size() const override { return _result.size(); }
+    const VCounter &value() const override { return _value; }
+    const VResult &result() const override { return _result; }
+    Result total() const override { return _total; }
+
+  private:
+    VCounter _value;
+    VResult _result;
+    Result _total;
+};
+
+typedef VectorCopyBase<VectorInfo> VectorCopy;
+
+class FormulaCopy : public VectorCopyBase<FormulaInfo>
+{
+  public:
+    FormulaCopy(const FormulaInfo &orig)
+        : VectorCopyBase(orig), _str(orig.str())
+    {
+    }
+
+    bool zero() const override { return allZero(result()); }
+    std::string str() const override { return _str; }
+
+  private:
+    const std::string _str;
+};
+
+class DistCopy : public InfoCopy<DistInfo>
+{
+  public:
+    DistCopy(const DistInfo &orig) : InfoCopy(orig) {}
+
+    void
+    update(const DistInfo &orig)
+    {
+        updatePrereq(orig);
+        data = orig.data;
+    }
+
+    bool zero() const override { return data.samples == 0; }
+};
+
+class VectorDistCopy : public InfoCopy<VectorDistInfo>
+{
+  public:
+    VectorDistCopy(const VectorDistInfo &orig)
+        : InfoCopy(orig)
+    {
+        subnames = orig.subnames;
+        subdescs = orig.subdescs;
+    }
+
+    void
+    update(const VectorDistInfo &orig)
+    {
+        updatePrereq(orig);
+        data = orig.data;
+    }
+
+    bool
+    zero() const override
+    {
+        return std::all_of(data.begin(), data.end(),
+                           [](const DistData &d) { return d.samples == 0; });
+    }
+
+    size_type size() const override { return data.size(); }
+};
+
+class Vector2dCopy : public InfoCopy<Vector2dInfo>
+{
+  public:
+    Vector2dCopy(const Vector2dInfo &orig)
+        : InfoCopy(orig)
+    {
+        subnames = orig.subnames;
+        subdescs = orig.subdescs;
+        y_subnames = orig.y_subnames;
+    }
+
+    void
+    update(const Vector2dInfo &orig)
+    {
+        updatePrereq(orig);
+        x = orig.x;
+        y = orig.y;
+        cvec = orig.cvec;
+        _total = orig.total();
+    }
+
+    bool zero() const override { return allZero(cvec); }
+    Result total() const override { return _total; }
+
+  private:
+    Result _total;
+};
+
+class SparseHistCopy : public InfoCopy<SparseHistInfo>
+{
+  public:
+    SparseHistCopy(const SparseHistInfo &orig) : InfoCopy(orig) {}
+
+    void
+    update(const SparseHistInfo &orig)
+    {
+        updatePrereq(orig);
+        data = orig.data;
+    }
+
+    bool zero() const override { return data.samples == 0; }
+};
+
+/** Live asynchronous outputs, drained when the simulator exits. */
+std::mutex asyncOutputsMutex;
+std::vector<Async *> asyncOutputs;
+
+} // anonymous namespace
+
+Async::Async(Output &_output, unsigned max_pending)
+    : output(_output), maxPending(std::max(max_pending, 1u)),
+      allocated(0), busy(false), stopping(false),
+      outputValid(_output.valid())
+{
+    static bool exitCallbackRegistered = false;
+
+    {
+        std::lock_guard<std::mutex> lock(asyncOutputsMutex);
+        asyncOutputs.push_back(this);
+        if (!exitCallbackRegistered) {
+            registerExitCallback([]() {
+                std::lock_guard<std::mutex> lock(asyncOutputsMutex);
+                for (auto *async : asyncOutputs)
+                    async->drain();
+            });
+            exitCallbackRegistered = true;
+        }
+    }
+
+    thread = std::thread(&Async::writer, this);
+}
+
+Async::~Async()
+{
+    {
+        std::lock_guard<std::mutex> lock(asyncOutputsMutex);
+        asyncOutputs.erase(std::find(asyncOutputs.begin(),
+                                     asyncOutputs.end(), this));
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    pendingCond.notify_one();
+    thread.join();
+}
+
+void
+Async::drain()
+{
+    std::unique_lock<std::mutex> lock(mutex);
+    doneCond.wait(lock, [this]() { return pending.empty() && !busy; });
+}
+
+void
+Async::writer()
+{
+    EventQueue queue("stats writer");
+    curEventQueue(&queue);
+
+    std::unique_lock<std::mutex> lock(mutex);
+    while (true) {
+        pendingCond.wait(lock,
+                         [this]() { return stopping || !pending.empty(); });
+        if (pending.empty()) {
+            // Only exit once everything queued has been written.
+            assert(stopping);
+            return;
+        }
+
+        std::unique_ptr<Snapshot> snapshot = std::move(pending.front());
+        pending.pop_front();
+        busy = true;
+        lock.unlock();
+
+        queue.setCurTick(snapshot->tick);
+        output.begin();
+        for (const auto &event : snapshot->events) {
+            switch (event.type) {
+              case Event::BeginGroup:
+                output.beginGroup(event.name.c_str());
+                break;
+              case Event::EndGroup:
+                output.endGroup();
+                break;
+              case Event::Visit:
+                event.info->visit(output);
+                break;
+            }
+        }
+        output.end();
+        outputValid = output.valid();
+
+        lock.lock();
+        free.push_back(std::move(snapshot));
+        busy = false;
+        doneCond.notify_all();
+    }
+}
+
+void
+Async::begin()
+{
+    assert(!current);
+
+    std::unique_lock<std::mutex> lock(mutex);
+    if (free.empty() && allocated < maxPending + 1) {
+        // One snapshot can be recorded while maxPending are queued
+        // or being written.
+        allocated++;
+        current.reset(new Snapshot);
+    } else {
+        doneCond.wait(lock, [this]() { return !free.empty(); });
+        current = std::move(free.back());
+        free.pop_back();
+    }
+    current->tick = curTick();
+    current->events.clear();
+}
+
+void
+Async::end()
+{
+    assert(current);
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        pending.push_back(std::move(current));
+    }
+    pendingCond.notify_one();
+}
+
+bool
+Async::valid() const
+{
+    return outputValid;
+}
+
+void
+Async::beginGroup(const char *name)
+{
+    current->events.push_back(Event{Event::BeginGroup, name, nullptr});
+}
+
+void
+Async::endGroup()
+{
+    current->events.push_back(Event{Event::EndGroup, "", nullptr});
+}
+
+template <class Copy, class Orig>
+Copy &
+Async::snapshot(const Orig &info)
+{
+    assert(info.id >= 0);
+    auto &infos = current->infos;
+    if (info.id >= infos.size())
+        infos.resize(info.id + 1);
+
+    Copy *copy = dynamic_cast<Copy *>(infos[info.id].get());
+    if (!copy) {
+        copy = new Copy(info);
+        infos[info.id].reset(copy);
+    }
+
+    copy->update(info);
+    current->events.push_back(Event{Event::Visit, "", copy});
+    return *copy;
+}
+
+void
+Async::visit(const ScalarInfo &info)
+{
+    snapshot<ScalarCopy>(info);
+}
+
+void
+Async::visit(const VectorInfo &info)
+{
+    snapshot<VectorCopy>(info);
+}
+
+void
+Async::visit(const DistInfo &info)
+{
+    snapshot<DistCopy>(info);
+}
+
+void
+Async::visit(const VectorDistInfo &info)
+{
+    snapshot<VectorDistCopy>(info);
+}
+
+void
+Async::visit(const Vector2dInfo &info)
+{
+    snapshot<Vector2dCopy>(info);
+}
+
+void
+Async::visit(const FormulaInfo &info)
+{
+    snapshot<FormulaCopy>(info);
+}
+
+void
+Async::visit(const SparseHistInfo &info)
+{
+    snapshot<SparseHistCopy>(info);
+}
+
+std::unique_ptr<Output>
+initAsync(Output *output, unsigned max_pending)
+{
+    panic_if(!output, "An asynchronous stat output needs an output to "
+             "wrap.\n");
+    return std::unique_ptr<Output>(new Async(*output, max_pending));
+}
+
+} // namespace Stats
@@ -0,0 +1,169 @@
+/*
+ * Copyright (c) 2026 The gem5 Authors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __BASE_STATS_ASYNC_HH__
+#define __BASE_STATS_ASYNC_HH__
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "base/stats/output.hh"
+#include "base/types.hh"
+
+namespace Stats {
+
+class Info;
+
+/**
+ * Output that moves the formatting and writing of stat dumps to a
+ * background thread.
+ *
+ * During a dump, the values of every visited stat are copied into a
+ * snapshot on the simulation thread. The snapshot is then handed to
+ * a writer thread which replays it, including groups, into the
+ * wrapped output while the simulation continues. The wrapped output
+ * is only ever used from the writer thread.
+ *
+ * Formulas read live counters, so they are evaluated when the
+ * snapshot is taken. Everything the wrapped output does with the
+ * values (formatting, compression and I/O) happens off the
+ * simulation thread. The writer thread has its own event queue whose
+ * current tick is set to the tick of the dump being written, so
+ * outputs calling curTick() see the same value as in a synchronous
+ * dump.
+ *
+ * At most a fixed number of snapshots are kept; a dump blocks if the
+ * writer falls that far behind. Snapshots are recycled, so the
+ * stat descriptions are only copied the first time a stat is seen.
+ */
+class Async : public Output
+{
+  public:
+    /**
+     * @param output Output the snapshots are replayed into. It must
+     *               outlive this object.
+     * @param max_pending Maximum number of dumps waiting to be
+     *                    written.
+     */
+    Async(Output &output, unsigned max_pending);
+    ~Async();
+
+    Async() = delete;
+    Async(const Async &other) = delete;
+
+    /** Wait until all pending dumps have been written. */
+    void drain();
+
+  public: // Output interface
+    void begin() override;
+    void end() override;
+    bool valid() const override;
+
+    void beginGroup(const char *name) override;
+    void endGroup() override;
+
+    void visit(const ScalarInfo &info) override;
+    void visit(const VectorInfo &info) override;
+    void visit(const DistInfo &info) override;
+    void visit(const VectorDistInfo &info) override;
+    void visit(const Vector2dInfo &info) override;
+    void visit(const FormulaInfo &info) override;
+    void visit(const SparseHistInfo &info) override;
+
+  protected:
+    /** One step of a recorded dump. */
+    struct Event
+    {
+        enum Type { BeginGroup, EndGroup, Visit };
+
+        Type type;
+        /** Group name for BeginGroup events. */
+        std::string name;
+        /** Copy of the stat for Visit events. */
+        Info *info;
+    };
+
+    /** A recorded dump. */
+    struct Snapshot
+    {
+        /** Tick at which the dump was taken. */
+        Tick tick;
+        std::vector<Event> events;
+        /** Stat copies owned by this snapshot, indexed by stat id. */
+        std::vector<std::unique_ptr<Info>> infos;
+    };
+
+    /**
+     * Get the copy of a stat in the current snapshot, creating it
+     * and copying the stat's description if needed.
+     */
+    template <class Copy, class Orig>
+    Copy &snapshot(const Orig &info);
+
+    /** Writer thread main loop. */
+    void writer();
+
+  protected:
+    Output &output;
+    const unsigned maxPending;
+
+    /** Snapshot being recorded by the simulation thread. */
+    std::unique_ptr<Snapshot> current;
+
+    std::mutex mutex;
+    /** Signalled when a snapshot is queued or on shutdown. */
+    std::condition_variable pendingCond;
+    /** Signalled when the writer is done with a snapshot. */
+    std::condition_variable doneCond;
+    /** Recorded snapshots waiting for the writer. */
+    std::deque<std::unique_ptr<Snapshot>> pending;
+    /** Snapshots ready to be reused. */
+    std::vector<std::unique_ptr<Snapshot>> free;
+    /** Number of snapshots allocated so far. */
+    unsigned allocated;
+    /** Set while the writer is replaying a snapshot. */
+    bool busy;
+    bool stopping;
+
+    /** Result of valid() on the wrapped output after the last write. */
+    std::atomic<bool> outputValid;
+
+    std::thread thread;
+};
+
+std::unique_ptr<Output> initAsync(Output *output, unsigned max_pending = 2);
+
+} // namespace Stats
+
+#endif // __BASE_STATS_ASYNC_HH__
@@ -0,0 +1,403 @@
+/*
+ * Copyright (c) 2026 The gem5 Authors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "base/stats/binary.hh"
+
+#include <zlib.h>
+
+#include <cstring>
+#include <ostream>
+
+#include "base/logging.hh"
+#include "base/stats/info.hh"
+#include "sim/core.hh"
+
+namespace {
+
+template <typename T>
+void
+put(std::string &buf, T value)
+{
+    buf.append(reinterpret_cast<const char *>(&value), sizeof(value));
+}
+
+void
+putString(std::string &buf, const std::string &str)
+{
+    put<uint32_t>(buf, str.size());
+    buf.append(str);
+}
+
+void
+putStrings(std::string &buf, const std::vector<std::string> &strs)
+{
+    put<uint32_t>(buf, strs.size());
+    for (const auto &str : strs)
+        putString(buf, str);
+}
+
+} // anonymous namespace
+
+namespace Stats {
+
+Binary::Binary(std::ostream &_stream, bool _compress)
+    : stream(_stream), compress(_compress), position(0),
+      schemaChanged(false), headerWritten(false), anySkipped(false)
+{
+}
+
+void
+Binary::begin()
+{
+    if (!headerWritten) {
+        std::string header("gem5stat");
+        put<uint32_t>(header, 0x01020304);
+        put<uint32_t>(header, version);
+        stream.write(header.data(), header.size());
+        headerWritten = true;
+    }
+
+    path.clear();
+    values.clear();
+    present.clear();
+    position = 0;
+    schemaChanged = false;
+    anySkipped = false;
+}
+
+void
+Binary::end()
+{
+    // Stats that disappeared since the last dump also change the
+    // schema.
+    if (position != schema.size()) {
+        schema.resize(position);
+        schemaChanged = true;
+    }
+
+    if (schemaChanged)
+        writeRecord(RecordSchema, schemaPayload());
+
+    if (anySkipped && !schemaChanged) {
+        writeRecord(RecordDeltaFrame, deltaFramePayload());
+    } else {
+        std::string frame;
+        frame.reserve(sizeof(uint64_t) + values.size() * sizeof(double));
+        put<uint64_t>(frame, curTick());
+        frame.append(reinterpret_cast<const char *>(values.data()),
+                     values.size() * sizeof(double));
+        writeRecord(RecordFrame, frame);
+    }
+
+    stream.flush();
+    lastValues.swap(values);
+}
+
+bool
+Binary::valid() const
+{
+    return stream.good();
+}
+
+void
+Binary::beginGroup(const char *name)
+{
+    path.push_back(name);
+}
+
+void
+Binary::endGroup()
+{
+    assert(!path.empty());
+    path.pop_back();
+}
+
+void
+Binary::addEntry(const Info &info, Kind kind, std::vector<uint32_t> &&shape)
+{
+    present.push_back(true);
+
+    if (!schemaChanged && position < schema.size()) {
+        Entry &entry = schema[position];
+        if (entry.id == info.id && entry.kind == kind &&
+            entry.shape == shape) {
+            entry.info = &info;
+            position++;
+            return;
+        }
+    }
+
+    // The stat doesn't match the last schema. Everything up to here
+    // is unchanged, but everything after it has to be described
+    // again.
+    schema.resize(position);
+    schemaChanged = true;
+
+    std::string name;
+    for (const auto &group : path) {
+        name += group;
+        name += '.';
+    }
+    name += info.name;
+
+    size_t size = 1;
+    for (auto dim : shape)
+        size *= dim;
+
+    schema.push_back(Entry{&info, info.id, kind, std::move(shape),
+                           std::move(name), size});
+    position++;
+}
+
+bool
+Binary::skip(const Info &info)
+{
+    if (!info.flags.isSet(display))
+        return true;
+
+    // The stat can only be left out if it is where the last schema
+    // expects it. Otherwise it has to be described again.
+    if (schemaChanged || position >= schema.size() ||
+        schema[position].id != info.id) {
+        return false;
+    }
+    schema[position].info = &info;
+
+    // Keep the values of the last dump in case the schema changes
+    // later in this dump and a full frame has to be written.
+    const size_t offset = values.size();
+    const size_t size = schema[position].size;
+    assert(offset + size <= lastValues.size());
+    values.insert(values.end(), lastValues.begin() + offset,
+                  lastValues.begin() + offset + size);
+
+    present.push_back(false);
+    anySkipped = true;
+    position++;
+    return true;
+}
+
+void
+Binary::appendDist(const DistData &data)
+{
+    const double fields[distFields] = {
+        data.min, data.max, data.bucket_size,
+        data.min_val, data.max_val, data.underflow, data.overflow,
+        data.sum, data.squares, data.logs, data.samples,
+    };
+
+    values.insert(values.end(), fields, fields + distFields);
+    values.insert(values.end(), data.cvec.begin(), data.cvec.end());
+}
+
+void
+Binary::visit(const ScalarInfo &info)
+{
+    if (!info.flags.isSet(display))
+        return;
+
+    addEntry(info, KindScalar, {});
+    values.push_back(info.result());
+}
+
+void
+Binary::visit(const VectorInfo &info)
+{
+    if (!info.flags.isSet(display))
+        return;
+
+    const VResult &vr = info.result();
+    addEntry(info, KindVector, { (uint32_t)vr.size() });
+    values.insert(values.end(), vr.begin(), vr.end());
+}
+
+void
+Binary::visit(const DistInfo &info)
+{
+    if (!info.flags.isSet(display))
+        return;
+
+    addEntry(info, KindDist,
+             { (uint32_t)(distFields + info.data.cvec.size()) });
+    appendDist(info.data);
+}
+
+void
+Binary::visit(const VectorDistInfo &info)
+{
+    if (!info.flags.isSet(display))
+        return;
+
+    const size_t buckets = info.data.empty() ? 0 : info.data[0].cvec.size();
+    addEntry(info, KindVectorDist,
+             { (uint32_t)info.data.size(), (uint32_t)(distFields + buckets) });
+    for (const auto &data : info.data) {
+        panic_if(data.cvec.size() != buckets,
+                 "Distributions in %s have different bucket counts.\n",
+                 info.name);
+        appendDist(data);
+    }
+}
+
+void
+Binary::visit(const Vector2dInfo &info)
+{
+    if (!info.flags.isSet(display))
+        return;
+
+    addEntry(info, KindVector2d, { (uint32_t)info.x, (uint32_t)info.y });
+    values.insert(values.end(), info.cvec.begin(), info.cvec.end());
+}
+
+void
+Binary::visit(const FormulaInfo &info)
+{
+    if (!info.flags.isSet(display))
+        return;
+
+    const VResult &vr = info.result();
+    addEntry(info, KindFormula, { (uint32_t)vr.size() });
+    values.insert(values.end(), vr.begin(), vr.end());
+}
+
+void
+Binary::visit(const SparseHistInfo &info)
+{
+    warn_once("Binary stat files don't support sparse histograms.\n");
+}
+
+std::string
+Binary::schemaPayload() const
+{
+    std::string buf;
+    put<uint32_t>(buf, schema.size());
+    for (const auto &entry : schema) {
+        const Info &info = *entry.info;
+        put<uint8_t>(buf, entry.kind);
+        put<uint32_t>(buf, entry.shape.size());
+        for (auto dim : entry.shape)
+            put<uint32_t>(buf, dim);
+        putString(buf, entry.name);
+        putString(buf, info.desc);
+
+        // Subfield names, where the stat has any
+        switch (entry.kind) {
+          case KindVector:
+          case KindFormula: {
+            auto &vinfo = static_cast<const VectorInfo &>(info);
+            putStrings(buf, vinfo.subnames);
+            putStrings(buf, {});
+            break;
+          }
+          case KindVector2d: {
+            auto &vinfo = static_cast<const Vector2dInfo &>(info);
+            putStrings(buf, vinfo.subnames);
+            putStrings(buf, vinfo.y_subnames);
+            break;
+          }
+          case KindVectorDist: {
+            auto &vinfo = static_cast<const VectorDistInfo &>(info);
+            putStrings(buf, vinfo.subnames);
+            putStrings(buf, {});
+            break;
+          }
+          default:
+            putStrings(buf, {});
+            putStrings(buf, {});
+            break;
+        }
+    }
+    return buf;
+}
+
+std::string
+Binary::deltaFramePayload() const
+{
+    assert(present.size() == schema.size());
+
+    std::string buf;
+    put<uint64_t>(buf, curTick());
+
+    std::string bitmap((schema.size() + 7) / 8, '\0');
+    for (size_t i = 0; i < schema.size(); i++) {
+        if (present[i])
+            bitmap[i / 8] |= 1 << (i % 8);
+    }
+    buf.append(bitmap);
+
+    size_t offset = 0;
+    for (size_t i = 0; i < schema.size(); i++) {
+        const size_t size = schema[i].size;
+        if (present[i]) {
+            const double *data = values.data() + offset;
+            buf.append(reinterpret_cast<const char *>(data),
+                       size * sizeof(double));
+        }
+        offset += size;
+    }
+    return buf;
+}
+
+void
+Binary::writeRecord(Record type, const std::string &payload)
+{
+    uint32_t flags = 0;
+    const char *data = payload.data();
+    uint64_t size = payload.size();
+
+    if (compress) {
+        uLongf zsize = compressBound(payload.size());
+        compressed.resize(zsize);
+        int ret = compress2(compressed.data(), &zsize,
+                            (const Bytef *)payload.data(), payload.size(),
+                            Z_BEST_SPEED);
+        panic_if(ret != Z_OK, "Failed to compress stats: %s\n", zError(ret));
+        flags |= FlagCompressed;
+        data = (const char *)compressed.data();
+        size = zsize;
+    }
+
+    std::string header;
+    put<uint32_t>(header, type);
+    put<uint32_t>(header, flags);
+    put<uint64_t>(header, size);
+    put<uint64_t>(header, payload.size());
+    stream.write(header.data(), header.size());
+    stream.write(data, size);
+}
+
+std::unique_ptr<Output>
+initBinary(const std::string &filename, bool compress)
+{
+    OutputStream *os = simout.create(filename, true, true);
+    fatal_if(!os->stream()->good(),
+             "Unable to open statistics file '%s' for writing\n", filename);
+    return std::unique_ptr<Output>(new Binary(*os->stream(), compress));
+}
+
+} // namespace Stats
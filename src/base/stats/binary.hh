@@ -0,0 +1,194 @@
+/*
+ * Copyright (c) 2026 The gem5 Authors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __BASE_STATS_BINARY_HH__
+#define __BASE_STATS_BINARY_HH__
+
+#include <cstdint>
+#include <iosfwd>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "base/output.hh"
+#include "base/stats/output.hh"
+#include "base/stats/types.hh"
+
+namespace Stats {
+
+struct DistData;
+
+/**
+ * Compact binary stat output intended for frequent periodic dumps.
+ *
+ * The file starts with a small header followed by a sequence of
+ * records. A schema record describes every stat (name, kind, shape
+ * and subnames) and is only written on the first dump or when the
+ * set of stats changes. Every dump then appends a frame record
+ * holding the current tick and the raw values of all stats, in schema
+ * order, as native doubles. Frames can optionally be compressed with
+ * zlib. See src/python/m5/stats/binary.py for a reader.
+ *
+ * Stats left out by a filter such as Delta (see skip()) keep their
+ * place in the schema. If the schema didn't change, such a dump is
+ * written as a delta frame holding the tick, a bitmap of the stats
+ * that are present (bit i of byte i / 8 for stat i) and the values of
+ * those stats only. The other stats have the values of the previous
+ * frame.
+ *
+ * All integers and doubles are stored in host byte order; the header
+ * contains a byte order mark so that readers can detect a mismatch.
+ */
+class Binary : public Output
+{
+  public:
+    /** Stat kinds, as stored in the schema. */
+    enum Kind : uint8_t
+    {
+        KindScalar = 0,
+        KindVector = 1,
+        KindVector2d = 2,
+        KindDist = 3,
+        KindVectorDist = 4,
+        KindFormula = 5,
+    };
+
+    /** Record types following the file header. */
+    enum Record : uint32_t
+    {
+        RecordSchema = 1,
+        RecordFrame = 2,
+        RecordDeltaFrame = 3,
+    };
+
+    /** Record flags. */
+    static const uint32_t FlagCompressed = 0x1;
+
+    /** File format version written to the header. */
+    static const uint32_t version = 1;
+
+    /**
+     * Number of values stored for a distribution before its buckets:
+     * min, max, bucket_size, min_val, max_val, underflow, overflow,
+     * sum, squares, logs and samples.
+     */
+    static const unsigned distFields = 11;
+
+    Binary(std::ostream &stream, bool compress);
+
+    Binary() = delete;
+    Binary(const Binary &other) = delete;
+
+  public: // Output interface
+    void begin() override;
+    void end() override;
+    bool valid() const override;
+
+    void beginGroup(const char *name) override;
+    void endGroup() override;
+
+    void visit(const ScalarInfo &info) override;
+    void visit(const VectorInfo &info) override;
+    void visit(const DistInfo &info) override;
+    void visit(const VectorDistInfo &info) override;
+    void visit(const Vector2dInfo &info) override;
+    void visit(const FormulaInfo &info) override;
+    void visit(const SparseHistInfo &info) override;
+
+    bool skip(const Info &info) override;
+
+  protected:
+    /**
+     * Schema entry for a single stat. Stats are matched by id, since
+     * asynchronous outputs pass a different copy of a stat on every
+     * dump. The info pointer is refreshed whenever the stat is seen.
+     */
+    struct Entry
+    {
+        const Info *info;
+        int id;
+        Kind kind;
+        std::vector<uint32_t> shape;
+        std::string name;
+        /** Number of values stored for the stat. */
+        size_t size;
+    };
+
+    /**
+     * Check the stat at the current position against the schema and
+     * start a new schema from this point if it doesn't match.
+     */
+    void addEntry(const Info &info, Kind kind,
+                  std::vector<uint32_t> &&shape);
+
+    /** Append the values of a distribution to the current frame. */
+    void appendDist(const DistData &data);
+
+    /** Write a record to the stream, compressing it if enabled. */
+    void writeRecord(Record type, const std::string &payload);
+
+    /** Serialize the current schema. */
+    std::string schemaPayload() const;
+
+    /** Serialize the present stats of the current dump. */
+    std::string deltaFramePayload() const;
+
+  protected:
+    std::ostream &stream;
+    const bool compress;
+
+    /** Names of the groups enclosing the current stat. */
+    std::vector<std::string> path;
+
+    /** Stats described by the last schema written (or being built). */
+    std::vector<Entry> schema;
+    /** Index of the next stat in the schema during a dump. */
+    size_t position;
+    /** Set if the schema has changed during the current dump. */
+    bool schemaChanged;
+    /** Set once the file header has been written. */
+    bool headerWritten;
+
+    /** Values of the current dump. */
+    std::vector<double> values;
+    /** Values of the previous dump, used to fill in skipped stats. */
+    std::vector<double> lastValues;
+    /** Whether each stat of the current dump was visited or skipped. */
+    std::vector<bool> present;
+    /** Set if a stat was skipped during the current dump. */
+    bool anySkipped;
+    /** Scratch space for compressed records. */
+    std::vector<uint8_t> compressed;
+};
+
+std::unique_ptr<Output> initBinary(const std::string &filename,
+                                   bool compress = true);
+
+} // namespace Stats
+
+#endif // __BASE_STATS_BINARY_HH__
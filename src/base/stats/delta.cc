@@ -0,0 +1,183 @@
+/*
+ * Copyright (c) 2026 The gem5 Authors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "base/stats/delta.hh"
+
+#include <cstring>
+
+#include "base/logging.hh"
+#include "base/stats/info.hh"
+
+namespace Stats {
+
+Delta::Delta(Output &_output)
+    : output(_output)
+{
+}
+
+void
+Delta::begin()
+{
+    output.begin();
+}
+
+void
+Delta::end()
+{
+    output.end();
+}
+
+bool
+Delta::valid() const
+{
+    return output.valid();
+}
+
+void
+Delta::beginGroup(const char *name)
+{
+    output.beginGroup(name);
+}
+
+void
+Delta::endGroup()
+{
+    output.endGroup();
+}
+
+bool
+Delta::changed(const Info &info)
+{
+    assert(info.id >= 0);
+    if (info.id >= last.size()) {
+        last.resize(info.id + 1);
+        seen.resize(info.id + 1, false);
+    }
+
+    // Compare the raw bits so that a stat stuck at NaN counts as
+    // unchanged.
+    std::vector<Counter> &prev = last[info.id];
+    if (seen[info.id] && prev.size() == current.size() &&
+        std::memcmp(prev.data(), current.data(),
+                    current.size() * sizeof(Counter)) == 0) {
+        return false;
+    }
+
+    seen[info.id] = true;
+    prev.swap(current);
+    return true;
+}
+
+void
+Delta::appendDist(const DistData &data)
+{
+    current.push_back(data.min_val);
+    current.push_back(data.max_val);
+    current.push_back(data.underflow);
+    current.push_back(data.overflow);
+    current.push_back(data.sum);
+    current.push_back(data.squares);
+    current.push_back(data.logs);
+    current.push_back(data.samples);
+    current.insert(current.end(), data.cvec.begin(), data.cvec.end());
+}
+
+void
+Delta::visit(const ScalarInfo &info)
+{
+    current.assign(1, info.result());
+    if (changed(info) || !output.skip(info))
+        output.visit(info);
+}
+
+void
+Delta::visit(const VectorInfo &info)
+{
+    const VResult &vr = info.result();
+    current.assign(vr.begin(), vr.end());
+    if (changed(info) || !output.skip(info))
+        output.visit(info);
+}
+
+void
+Delta::visit(const DistInfo &info)
+{
+    current.clear();
+    appendDist(info.data);
+    if (changed(info) || !output.skip(info))
+        output.visit(info);
+}
+
+void
+Delta::visit(const VectorDistInfo &info)
+{
+    current.clear();
+    for (const auto &data : info.data)
+        appendDist(data);
+    if (changed(info) || !output.skip(info))
+        output.visit(info);
+}
+
+void
+Delta::visit(const Vector2dInfo &info)
+{
+    current.assign(info.cvec.begin(), info.cvec.end());
+    if (changed(info) || !output.skip(info))
+        output.visit(info);
+}
+
+void
+Delta::visit(const FormulaInfo &info)
+{
+    const VResult &vr = info.result();
+    current.assign(vr.begin(), vr.end());
+    if (changed(info) || !output.skip(info))
+        output.visit(info);
+}
+
+void
+Delta::visit(const SparseHistInfo &info)
+{
+    current.clear();
+    current.push_back(info.data.samples);
+    for (const auto &bucket : info.data.cmap) {
+        current.push_back(bucket.first);
+        current.push_back(bucket.second);
+    }
+    if (changed(info) || !output.skip(info))
+        output.visit(info);
+}
+
+std::unique_ptr<Output>
+initDelta(Output *output)
+{
+    panic_if(!output, "A delta stat output needs an output to wrap.\n");
+    return std::unique_ptr<Output>(new Delta(*output));
+}
+
+} // namespace Stats
@@ -0,0 +1,109 @@
+/*
+ * Copyright (c) 2026 The gem5 Authors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __BASE_STATS_DELTA_HH__
+#define __BASE_STATS_DELTA_HH__
+
+#include <memory>
+#include <vector>
+
+#include "base/stats/output.hh"
+#include "base/stats/types.hh"
+
+namespace Stats {
+
+struct DistData;
+
+/**
+ * Output filter that only forwards the stats whose value changed
+ * since the previous dump to another output.
+ *
+ * The values of every visited stat are compared to a copy kept from
+ * the last dump. Unchanged stats are dropped before they reach the
+ * wrapped output, which saves formatting them. The wrapped output is
+ * told about them through Output::skip() and can ask for them to be
+ * visited anyway. Groups are always forwarded so that the wrapped
+ * output sees the usual stat names. The first dump forwards every
+ * stat.
+ */
+class Delta : public Output
+{
+  public:
+    /**
+     * @param output Output receiving the changed stats. It must
+     *               outlive this object.
+     */
+    Delta(Output &output);
+
+    Delta() = delete;
+    Delta(const Delta &other) = delete;
+
+  public: // Output interface
+    void begin() override;
+    void end() override;
+    bool valid() const override;
+
+    void beginGroup(const char *name) override;
+    void endGroup() override;
+
+    void visit(const ScalarInfo &info) override;
+    void visit(const VectorInfo &info) override;
+    void visit(const DistInfo &info) override;
+    void visit(const VectorDistInfo &info) override;
+    void visit(const Vector2dInfo &info) override;
+    void visit(const FormulaInfo &info) override;
+    void visit(const SparseHistInfo &info) override;
+
+  protected:
+    /**
+     * Compare the values collected in current with the ones from
+     * the last dump of the stat and remember them for the next dump.
+     *
+     * @return true if the stat should be forwarded.
+     */
+    bool changed(const Info &info);
+
+    /** Append the values of a distribution to current. */
+    void appendDist(const DistData &data);
+
+  protected:
+    Output &output;
+
+    /** Values from the previous dump, indexed by stat id. */
+    std::vector<std::vector<Counter>> last;
+    /** Set for the stats that have been dumped at least once. */
+    std::vector<bool> seen;
+    /** Values of the stat being visited. */
+    std::vector<Counter> current;
+};
+
+std::unique_ptr<Output> initDelta(Output *output);
+
+} // namespace Stats
+
+#endif // __BASE_STATS_DELTA_HH__
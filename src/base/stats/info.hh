@@ -95,6 +95,15 @@ class Info
     Info();
     virtual ~Info();
 
+  protected:
+    /**
+     * Create the info of a copy of an existing stat. The copy takes the
+     * id of that stat rather than a new one.
+     * @param id The id of the copied stat.
+     */
+    explicit Info(int id);
+
+  public:
     /** Set the name of this statistic */
     void setName(const std::string &name);
     void setName(const Group *parent, const std::string &name);
@@ -147,6 +156,12 @@ class Info
 
 class ScalarInfo : public Info
 {
+  public:
+    ScalarInfo() = default;
+
+  protected:
+    explicit ScalarInfo(int id) : Info(id) {}
+
   public:
     virtual Counter value() const = 0;
     virtual Result result() const = 0;
@@ -155,6 +170,12 @@ class ScalarInfo : public Info
 
 class VectorInfo : public Info
 {
+  public:
+    VectorInfo() = default;
+
+  protected:
+    explicit VectorInfo(int id) : Info(id) {}
+
   public:
     /** Names and descriptions of subfields. */
     std::vector<std::string> subnames;
@@ -192,6 +213,12 @@ struct DistData
 
 class DistInfo : public Info
 {
+  public:
+    DistInfo() = default;
+
+  protected:
+    explicit DistInfo(int id) : Info(id) {}
+
   public:
     /** Local storage for the entry values, used for printing. */
     DistData data;
@@ -199,6 +226,12 @@ class DistInfo : public Info
 
 class VectorDistInfo : public Info
 {
+  public:
+    VectorDistInfo() = default;
+
+  protected:
+    explicit VectorDistInfo(int id) : Info(id) {}
+
   public:
     std::vector<DistData> data;
 
@@ -217,6 +250,12 @@ class VectorDistInfo : public Info
 
 class Vector2dInfo : public Info
 {
+  public:
+    Vector2dInfo() = default;
+
+  protected:
+    explicit Vector2dInfo(int id) : Info(id) {}
+
   public:
     /** Names and descriptions of subfields. */
     std::vector<std::string> subnames;
@@ -236,6 +275,12 @@ class Vector2dInfo : public Info
 
 class FormulaInfo : public VectorInfo
 {
+  public:
+    FormulaInfo() = default;
+
+  protected:
+    explicit FormulaInfo(int id) : VectorInfo(id) {}
+
   public:
     virtual std::string str() const = 0;
 };
@@ -250,6 +295,12 @@ struct SparseHistData
 
 class SparseHistInfo : public Info
 {
+  public:
+    SparseHistInfo() = default;
+
+  protected:
+    explicit SparseHistInfo(int id) : Info(id) {}
+
   public:
     /** Local storage for the entry values, used for printing. */
     SparseHistData data;
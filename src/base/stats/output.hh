@@ -73,6 +73,14 @@ struct Output
     virtual void visit(const Vector2dInfo &info) = 0;
     virtual void visit(const FormulaInfo &info) = 0;
     virtual void visit(const SparseHistInfo &info) = 0; // Sparse histogram
+
+    /**
+     * Called by filters such as Delta for a stat that has the same
+     * value as in the previous dump, instead of visiting it.
+     *
+     * @return false if the stat has to be visited anyway.
+     */
+    virtual bool skip(const Info &info) { return true; }
 };
 
 } // namespace Stats
@@ -103,6 +103,13 @@ disable()
 ObjectMatch ignore;
 
 
+std::string &
+Logger::rawArgs()
+{
+    static thread_local std::string args;
+    return args;
+}
+
 void
 Logger::dump(Tick when, const std::string &name,
          const void *d, int len, const std::string &flag)
@@ -37,6 +37,7 @@
 #include "base/cprintf.hh"
 #include "base/debug.hh"
 #include "base/match.hh"
+#include "base/trace_args.hh"
 #include "base/types.hh"
 #include "sim/core.hh"
 
@@ -50,6 +51,19 @@ class Logger
     /** Name match for objects to ignore */
     ObjectMatch ignore;
 
+    /**
+     * Set by loggers that want messages unformatted, in which case
+     * logRawMessage() is called instead of logMessage() for messages
+     * with a format string.
+     */
+    bool rawMessages = false;
+
+    /**
+     * Scratch space for the arguments of raw messages. Each thread has
+     * its own, since several event queues may log at the same time.
+     */
+    static std::string &rawArgs();
+
   public:
     /** Log a single message */
     template <typename ...Args>
@@ -67,6 +81,13 @@ class Logger
     {
         if (!name.empty() && ignore.match(name))
             return;
+        if (rawMessages) {
+            std::string &raw_args = rawArgs();
+            raw_args.clear();
+            ArgEncoder(raw_args).add(args...);
+            logRawMessage(when, name, flag, fmt, raw_args);
+            return;
+        }
         std::ostringstream line;
         ccprintf(line, fmt, args...);
         logMessage(when, name, flag, line.str());
@@ -80,6 +101,19 @@ class Logger
     virtual void logMessage(Tick when, const std::string &name,
             const std::string &flag, const std::string &message) = 0;
 
+    /**
+     * Log an unformatted message. Only called if rawMessages is set.
+     *
+     * @param fmt ccprintf() format string of the message
+     * @param args Arguments of the message, encoded by ArgEncoder
+     */
+    virtual void
+    logRawMessage(Tick when, const std::string &name,
+                  const std::string &flag, const char *fmt,
+                  const std::string &args)
+    {
+    }
+
     /** Return an ostream that can be used to send messages to
      *  the 'same place' as formatted logMessage messages.  This
      *  can be implemented to use a logger's underlying ostream,
@@ -87,6 +121,12 @@ class Logger
      *  way, or just set to one of std::cout, std::cerr */
     virtual std::ostream &getOstream() = 0;
 
+    /**
+     * Write out messages buffered by the logger. Also called when the
+     * simulator aborts, e.g., on a panic.
+     */
+    virtual void flush() {}
+
     /** Set objects to ignore */
     void setIgnore(ObjectMatch &ignore_) { ignore = ignore_; }
 
@@ -0,0 +1,194 @@
+/*
+ * Copyright (c) 2026 The gem5 Authors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __BASE_TRACE_ARGS_HH__
+#define __BASE_TRACE_ARGS_HH__
+
+#include <cstdint>
+#include <cstring>
+#include <sstream>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+namespace Trace {
+
+/**
+ * Type tags of the arguments recorded by loggers that store messages
+ * unformatted. Each argument is stored as its tag followed by its raw
+ * value, or by a 32-bit length and the characters for strings.
+ */
+enum class ArgType : uint8_t
+{
+    Bool,
+    Char,
+    SignedChar,
+    UnsignedChar,
+    Short,
+    UnsignedShort,
+    Int,
+    UnsignedInt,
+    Long,
+    UnsignedLong,
+    LongLong,
+    UnsignedLongLong,
+    Float,
+    Double,
+    LongDouble,
+    Pointer,
+    String,
+};
+
+/**
+ * Serialize the arguments of a trace message so that it can be
+ * formatted later with the same result as ccprintf(). Built-in types
+ * keep their type. Unscoped enums and classes that convert to an
+ * integer (e.g., BitUnions) are stored as that integer, so that
+ * integer format flags (e.g., %#x) still apply to them. Other types
+ * are converted to a string with their stream operator, so they
+ * ignore integer format flags.
+ */
+class ArgEncoder
+{
+  public:
+    ArgEncoder(std::string &_buf) : buf(_buf) {}
+
+    void add() {}
+
+    template <typename T, typename ...Args>
+    void
+    add(const T &arg, const Args &...args)
+    {
+        encode(arg);
+        add(args...);
+    }
+
+  private:
+    std::string &buf;
+
+    template <typename T>
+    void
+    put(ArgType type, const T &value)
+    {
+        buf.push_back(static_cast<char>(type));
+        buf.append(reinterpret_cast<const char *>(&value), sizeof(value));
+    }
+
+    void
+    putString(const char *str, size_t len)
+    {
+        const uint32_t len32 = len;
+        put(ArgType::String, len32);
+        buf.append(str, len);
+    }
+
+    void encode(bool v) { put(ArgType::Bool, v); }
+    void encode(char v) { put(ArgType::Char, v); }
+    void encode(signed char v) { put(ArgType::SignedChar, v); }
+    void encode(unsigned char v) { put(ArgType::UnsignedChar, v); }
+    void encode(short v) { put(ArgType::Short, v); }
+    void encode(unsigned short v) { put(ArgType::UnsignedShort, v); }
+    void encode(int v) { put(ArgType::Int, v); }
+    void encode(unsigned int v) { put(ArgType::UnsignedInt, v); }
+    void encode(long v) { put(ArgType::Long, v); }
+    void encode(unsigned long v) { put(ArgType::UnsignedLong, v); }
+    void encode(long long v) { put(ArgType::LongLong, v); }
+    void encode(unsigned long long v) { put(ArgType::UnsignedLongLong, v); }
+    void encode(float v) { put(ArgType::Float, v); }
+    void encode(double v) { put(ArgType::Double, v); }
+    void encode(long double v) { put(ArgType::LongDouble, v); }
+
+    void
+    encode(const char *str)
+    {
+        if (str)
+            putString(str, std::strlen(str));
+        else
+            putString("(null)", 6);
+    }
+
+    void encode(char *str) { encode(static_cast<const char *>(str)); }
+    void encode(const std::string &str) { putString(str.data(), str.size()); }
+
+    template <size_t N>
+    void
+    encode(const char (&str)[N])
+    {
+        putString(str, strnlen(str, N));
+    }
+
+    template <typename T>
+    void
+    encode(T *ptr)
+    {
+        const uint64_t value = reinterpret_cast<uintptr_t>(ptr);
+        put(ArgType::Pointer, value);
+    }
+
+    /** The integer type a value promotes to, if it has one */
+    template <typename T, typename = void>
+    struct Promoted
+    {
+        static const bool isInteger = false;
+    };
+
+    template <typename T>
+    struct Promoted<T, decltype(void(+std::declval<const T &>()))>
+    {
+        typedef decltype(+std::declval<const T &>()) Type;
+        static const bool isInteger = std::is_integral<Type>::value;
+    };
+
+    template <typename T>
+    void
+    encode(const T &value)
+    {
+        encodeOther(value, std::integral_constant<bool,
+                    Promoted<T>::isInteger>());
+    }
+
+    template <typename T>
+    void
+    encodeOther(const T &value, std::true_type)
+    {
+        encode(+value);
+    }
+
+    template <typename T>
+    void
+    encodeOther(const T &value, std::false_type)
+    {
+        std::ostringstream str;
+        str << value;
+        encode(str.str());
+    }
+};
+
+} // namespace Trace
+
+#endif // __BASE_TRACE_ARGS_HH__
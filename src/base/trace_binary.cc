@@ -0,0 +1,422 @@
+/*
+ * Copyright (c) 2026 The gem5 Authors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "base/trace_binary.hh"
+
+#include <cstdlib>
+#include <cstring>
+#include <istream>
+#include <ostream>
+
+#include "base/logging.hh"
+#include "sim/core.hh"
+
+namespace {
+
+const char traceMagic[8] = { 'g', 'e', 'm', '5', 't', 'r', 'c', '\0' };
+
+/** Flush the output buffer once it grows beyond this many bytes */
+const size_t flushThreshold = 1 << 20;
+
+/**
+ * fatal() exits without running the simulator's exit callbacks, so
+ * flush the debug logger from the C library's exit handlers as well.
+ */
+void
+flushAtExit()
+{
+    Trace::getDebugLogger()->flush();
+}
+
+template <typename T>
+void
+put(std::string &buf, const T &value)
+{
+    buf.append(reinterpret_cast<const char *>(&value), sizeof(value));
+}
+
+template <typename T>
+T
+get(std::istream &in)
+{
+    T value;
+    in.read(reinterpret_cast<char *>(&value), sizeof(value));
+    return value;
+}
+
+/**
+ * Read a string of len bytes from the argument buffer and advance the
+ * position. Returns false on truncated input.
+ */
+bool
+getBytes(const std::string &buf, size_t &pos, size_t len, const char *&data)
+{
+    if (pos + len > buf.size())
+        return false;
+    data = buf.data() + pos;
+    pos += len;
+    return true;
+}
+
+template <typename T>
+bool
+getArg(const std::string &buf, size_t &pos, T &value)
+{
+    const char *data;
+    if (!getBytes(buf, pos, sizeof(T), data))
+        return false;
+    std::memcpy(&value, data, sizeof(T));
+    return true;
+}
+
+template <typename T>
+bool
+replayArg(cp::Print &print, const std::string &buf, size_t &pos)
+{
+    T value;
+    if (!getArg(buf, pos, value))
+        return false;
+    print.add_arg(value);
+    return true;
+}
+
+/** Format a raw message the way ccprintf() would have done it */
+bool
+formatRaw(std::ostream &out, const std::string &fmt, const std::string &args)
+{
+    using Trace::ArgType;
+
+    cp::Print print(out, fmt);
+    size_t pos = 0;
+    while (pos < args.size()) {
+        const ArgType type = static_cast<ArgType>(args[pos++]);
+        bool ok;
+        switch (type) {
+          case ArgType::Bool:
+            ok = replayArg<bool>(print, args, pos);
+            break;
+          case ArgType::Char:
+            ok = replayArg<char>(print, args, pos);
+            break;
+          case ArgType::SignedChar:
+            ok = replayArg<signed char>(print, args, pos);
+            break;
+          case ArgType::UnsignedChar:
+            ok = replayArg<unsigned char>(print, args, pos);
+            break;
+          case ArgType::Short:
+            ok = replayArg<short>(print, args, pos);
+            break;
+          case ArgType::UnsignedShort:
+            ok = replayArg<unsigned short>(print, args, pos);
+            break;
+          case ArgType::Int:
+            ok = replayArg<int>(print, args, pos);
+            break;
+          case ArgType::UnsignedInt:
+            ok = replayArg<unsigned int>(print, args, pos);
+            break;
+          case ArgType::Long:
+            ok = replayArg<long>(print, args, pos);
+            break;
+          case ArgType::UnsignedLong:
+            ok = replayArg<unsigned long>(print, args, pos);
+            break;
+          case ArgType::LongLong:
+            ok = replayArg<long long>(print, args, pos);
+            break;
+          case ArgType::UnsignedLongLong:
+            ok = replayArg<unsigned long long>(print, args, pos);
+            break;
+          case ArgType::Float:
+            ok = replayArg<float>(print, args, pos);
+            break;
+          case ArgType::Double:
+            ok = replayArg<double>(print, args, pos);
+            break;
+          case ArgType::LongDouble:
+            ok = replayArg<long double>(print, args, pos);
+            break;
+          case ArgType::Pointer: {
+            uint64_t value;
+            ok = getArg(args, pos, value);
+            if (ok)
+                print.add_arg(reinterpret_cast<const void *>(value));
+            break;
+          }
+          case ArgType::String: {
+            uint32_t len;
+            const char *data;
+            ok = getArg(args, pos, len) && getBytes(args, pos, len, data);
+            if (ok)
+                print.add_arg(std::string(data, len));
+            break;
+          }
+          default:
+            ok = false;
+            break;
+        }
+
+        if (!ok)
+            return false;
+    }
+    print.end_args();
+    return true;
+}
+
+} // anonymous namespace
+
+namespace Trace {
+
+const uint32_t BinaryLogger::version;
+
+BinaryLogger::BinaryLogger(std::ostream &_stream, size_t ring_size)
+    : stream(_stream), ringSize(ring_size), textBuf(*this),
+      textStream(&textBuf)
+{
+    rawMessages = true;
+
+    std::string header(traceMagic, sizeof(traceMagic));
+    put(header, version);
+    stream.write(header.data(), header.size());
+
+    // Loggers are never deleted once they have been installed, make
+    // sure the records reach the file.
+    registerExitCallback([this]() { flush(); });
+    static const bool at_exit_registered = std::atexit(flushAtExit) == 0;
+    warn_if(!at_exit_registered,
+            "Debug records may be lost if gem5 exits with an error.\n");
+}
+
+BinaryLogger::~BinaryLogger()
+{
+    flush();
+}
+
+uint32_t
+BinaryLogger::intern(const char *str, size_t len)
+{
+    auto it = addressIds.find(str);
+    if (it != addressIds.end()) {
+        const std::string &known = strings[it->second];
+        if (known.size() == len && std::memcmp(known.data(), str, len) == 0)
+            return it->second;
+    }
+
+    std::string key(str, len);
+    auto sit = stringIds.find(key);
+    uint32_t id;
+    if (sit != stringIds.end()) {
+        id = sit->second;
+    } else {
+        id = strings.size();
+        strings.push_back(key);
+        stringIds.emplace(std::move(key), id);
+
+        // In ring mode, the string table is written when flushing
+        if (!ringSize) {
+            buffer.push_back(RecordString);
+            put<uint32_t>(buffer, id);
+            put<uint32_t>(buffer, len);
+            buffer.append(str, len);
+        }
+    }
+
+    addressIds[str] = id;
+    return id;
+}
+
+std::string &
+BinaryLogger::recordBuffer(size_t size)
+{
+    if (ringSize) {
+        // Keep two halves of the ring, dropping the oldest one once
+        // the current one is full.
+        if (buffer.size() + size > ringSize / 2 && !buffer.empty()) {
+            previous.swap(buffer);
+            buffer.clear();
+        }
+    } else if (buffer.size() + size > flushThreshold) {
+        writeBuffers();
+    }
+    return buffer;
+}
+
+void
+BinaryLogger::logMessage(Tick when, const std::string &name,
+        const std::string &flag, const std::string &message)
+{
+    if (!name.empty() && ignore.match(name))
+        return;
+
+    std::lock_guard<std::mutex> lock(mutex);
+    const uint32_t name_id = intern(name.data(), name.size());
+    const uint32_t flag_id = intern(flag.data(), flag.size());
+
+    std::string &buf = recordBuffer(21 + message.size());
+    buf.push_back(RecordText);
+    put<uint64_t>(buf, when);
+    put<uint32_t>(buf, name_id);
+    put<uint32_t>(buf, flag_id);
+    put<uint32_t>(buf, message.size());
+    buf.append(message);
+}
+
+void
+BinaryLogger::logRawMessage(Tick when, const std::string &name,
+        const std::string &flag, const char *fmt, const std::string &args)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    const uint32_t name_id = intern(name.data(), name.size());
+    const uint32_t flag_id = intern(flag.data(), flag.size());
+    const uint32_t fmt_id = intern(fmt, std::strlen(fmt));
+
+    std::string &buf = recordBuffer(25 + args.size());
+    buf.push_back(RecordMessage);
+    put<uint64_t>(buf, when);
+    put<uint32_t>(buf, name_id);
+    put<uint32_t>(buf, flag_id);
+    put<uint32_t>(buf, fmt_id);
+    put<uint32_t>(buf, args.size());
+    buf.append(args);
+}
+
+void
+BinaryLogger::flush()
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    writeBuffers();
+}
+
+void
+BinaryLogger::writeBuffers()
+{
+    if (ringSize) {
+        // The retained records may refer to any string seen so far
+        std::string table;
+        for (uint32_t id = 0; id < strings.size(); ++id) {
+            table.push_back(RecordString);
+            put<uint32_t>(table, id);
+            put<uint32_t>(table, strings[id].size());
+            table.append(strings[id]);
+        }
+        stream.write(table.data(), table.size());
+        stream.write(previous.data(), previous.size());
+        previous.clear();
+
+        // Start a new string table, records logged after this flush
+        // are written along with it.
+        strings.clear();
+        stringIds.clear();
+        addressIds.clear();
+    }
+
+    stream.write(buffer.data(), buffer.size());
+    buffer.clear();
+    stream.flush();
+}
+
+int
+BinaryLogger::TextBuf::sync()
+{
+    // Each flush of the ostream becomes one text message
+    if (!str().empty()) {
+        logger.logMessage(MaxTick, "", "", str());
+        str("");
+    }
+    return 0;
+}
+
+void
+formatBinaryTrace(std::istream &in, std::ostream &out)
+{
+    char magic[sizeof(traceMagic)];
+    in.read(magic, sizeof(magic));
+    fatal_if(!in || std::memcmp(magic, traceMagic, sizeof(magic)) != 0,
+             "Not a binary debug trace.\n");
+    const uint32_t file_version = get<uint32_t>(in);
+    fatal_if(file_version != BinaryLogger::version,
+             "Unsupported binary debug trace version %d.\n", file_version);
+
+    OstreamLogger logger(out);
+    std::vector<std::string> strings;
+    std::string data;
+
+    auto lookup = [&strings](uint32_t id) -> const std::string & {
+        fatal_if(id >= strings.size(), "Unknown string %d in trace.\n", id);
+        return strings[id];
+    };
+
+    while (true) {
+        const int type = in.get();
+        if (type == EOF)
+            break;
+
+        if (type == BinaryLogger::RecordString) {
+            const uint32_t id = get<uint32_t>(in);
+            const uint32_t len = get<uint32_t>(in);
+            data.resize(len);
+            in.read(&data[0], len);
+            if (!in)
+                break;
+            if (id >= strings.size())
+                strings.resize(id + 1);
+            strings[id] = data;
+            continue;
+        }
+
+        const Tick when = get<uint64_t>(in);
+        const uint32_t name = get<uint32_t>(in);
+        const uint32_t flag = get<uint32_t>(in);
+        uint32_t fmt = 0;
+        if (type == BinaryLogger::RecordMessage) {
+            fmt = get<uint32_t>(in);
+        } else {
+            fatal_if(type != BinaryLogger::RecordText,
+                     "Corrupt binary debug trace.\n");
+        }
+        const uint32_t len = get<uint32_t>(in);
+        data.resize(len);
+        in.read(&data[0], len);
+        if (!in) {
+            warn("Truncated binary debug trace.\n");
+            break;
+        }
+
+        if (type == BinaryLogger::RecordMessage) {
+            std::ostringstream line;
+            fatal_if(!formatRaw(line, lookup(fmt), data),
+                     "Corrupt message arguments in trace.\n");
+            logger.logMessage(when, lookup(name), lookup(flag), line.str());
+        } else {
+            logger.logMessage(when, lookup(name), lookup(flag), data);
+        }
+    }
+}
+
+} // namespace Trace
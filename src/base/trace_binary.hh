@@ -0,0 +1,159 @@
+/*
+ * Copyright (c) 2026 The gem5 Authors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __BASE_TRACE_BINARY_HH__
+#define __BASE_TRACE_BINARY_HH__
+
+#include <cstdint>
+#include <iosfwd>
+#include <memory>
+#include <mutex>
+#include <streambuf>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "base/open_hash_map.hh"
+#include "base/trace.hh"
+
+namespace Trace {
+
+/**
+ * Debug logger recording messages in a compact binary form instead of
+ * formatting them.
+ *
+ * Messages with a format string are stored as their tick, object
+ * name, flag and format string ids, followed by their raw arguments
+ * (see ArgEncoder). Names, flags and format strings are interned the
+ * first time they are used, so each of them is only written once.
+ * Messages that are already formatted (e.g., DDUMP, or text written
+ * to the logger's ostream) are stored as text.
+ *
+ * By default, records are buffered and appended to the output file.
+ * In ring mode, only the most recent records are kept in memory and
+ * written when the simulator exits, including through fatal() or
+ * panic(). Messages may be logged from several event queue threads at
+ * once, so all state is protected by a mutex.
+ *
+ * Use formatBinaryTrace() (or util/decode_debug_trace.py) to render
+ * the trace as the text the OstreamLogger would have produced.
+ */
+class BinaryLogger : public Logger
+{
+  public:
+    /** Record types in the trace file */
+    enum Record : uint8_t
+    {
+        RecordString = 'S',
+        RecordMessage = 'M',
+        RecordText = 'T',
+    };
+
+    /** File format version written to the header */
+    static const uint32_t version = 1;
+
+    /**
+     * @param stream Output stream, opened in binary mode.
+     * @param ring_size Keep only about this many bytes of the most
+     *                  recent records, or 0 to write all records.
+     */
+    BinaryLogger(std::ostream &stream, size_t ring_size = 0);
+    ~BinaryLogger();
+
+    void logMessage(Tick when, const std::string &name,
+            const std::string &flag, const std::string &message) override;
+
+    void logRawMessage(Tick when, const std::string &name,
+            const std::string &flag, const char *fmt,
+            const std::string &args) override;
+
+    std::ostream &getOstream() override { return textStream; }
+
+    /** Write all buffered records to the output stream */
+    void flush() override;
+
+  protected:
+    /** Stream buffer turning text written to getOstream() into records */
+    class TextBuf : public std::stringbuf
+    {
+      public:
+        TextBuf(BinaryLogger &_logger) : logger(_logger) {}
+
+      protected:
+        int sync() override;
+
+      private:
+        BinaryLogger &logger;
+    };
+
+    /** Get the id of a string, writing it to the trace if it is new */
+    uint32_t intern(const char *str, size_t len);
+
+    /** Get the buffer the next record of size bytes goes to */
+    std::string &recordBuffer(size_t size);
+
+    /** Write all buffered records, with the mutex held */
+    void writeBuffers();
+
+    std::ostream &stream;
+    const size_t ringSize;
+
+    /** Protects everything below, except the text stream */
+    std::mutex mutex;
+
+    /** Interned strings, indexed by id */
+    std::vector<std::string> strings;
+    /** Ids of interned strings by content */
+    std::unordered_map<std::string, uint32_t> stringIds;
+    /**
+     * Ids of interned strings by address, checked against the string
+     * content before use. Most names and format strings are seen
+     * again at the same address, so this avoids hashing them.
+     */
+    OpenHashMap<const char *, uint32_t> addressIds;
+
+    /** Records not yet written */
+    std::string buffer;
+    /** In ring mode, the records from before buffer was last cleared */
+    std::string previous;
+
+    TextBuf textBuf;
+    std::ostream textStream;
+};
+
+/**
+ * Render a binary trace as text.
+ *
+ * Messages are printed by an OstreamLogger writing to out, so the
+ * FmtFlag and FmtTicksOff debug flags of the current process apply.
+ */
+void formatBinaryTrace(std::istream &in, std::ostream &out);
+
+} // namespace Trace
+
+#endif // __BASE_TRACE_BINARY_HH__
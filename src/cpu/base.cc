@@ -398,6 +398,12 @@ BaseCPU::regStats()
         threadContexts[0]->regStats(name());
 }
 
+PortProxy::BulkAccessFunc
+BaseCPU::getBulkAccessFunc()
+{
+    return system->bulkAccessFunc();
+}
+
 Port &
 BaseCPU::getPort(const string &if_name, PortID idx)
 {
@@ -166,6 +166,14 @@ class BaseCPU : public ClockedObject
         return [port](PacketPtr pkt)->void { port->sendFunctional(pkt); };
     }
 
+    /**
+     * Returns a bulk access delegate for use with port proxies. CPUs
+     * that override getSendFunctional() must return nullptr if their
+     * delegate does not send accesses to the system's memory, so that
+     * all accesses go through it.
+     */
+    virtual PortProxy::BulkAccessFunc getBulkAccessFunc();
+
     /**
      * Purely virtual method that returns a reference to the instruction
      * port. All subclasses must implement this method.
@@ -60,6 +60,9 @@ class PyTrafficGen(BaseTrafficGen):
         PyBindMethod("createDramRot"),
         PyBindMethod("createHybrid"),
         PyBindMethod("createNvm"),
+        PyBindMethod("createBinaryTrace",
+                     args=["duration", "trace_file", ("addr_offset", 0),
+                           ("shard", 0), ("num_shards", 1)]),
     ]
 
     @cxxMethod(override=True)
@@ -42,6 +42,7 @@
 #include "base/random.hh"
 #include "config/have_protobuf.hh"
 #include "cpu/testers/traffic_gen/base_gen.hh"
+#include "cpu/testers/traffic_gen/binary_trace_gen.hh"
 #include "cpu/testers/traffic_gen/dram_gen.hh"
 #include "cpu/testers/traffic_gen/dram_rot_gen.hh"
 #include "cpu/testers/traffic_gen/exit_gen.hh"
@@ -176,44 +177,54 @@ BaseTrafficGen::update()
         transition();
     } else {
         assert(curTick() >= nextPacketTick);
-        // get the next packet and try to send it
-        PacketPtr pkt = activeGenerator->getNextPacket();
 
-        // If generating stream/substream IDs are enabled,
-        // try to pick and assign them to the new packet
-        if (streamGenerator) {
-            auto sid = streamGenerator->pickStreamID();
-            auto ssid = streamGenerator->pickSubStreamID();
+        // generators sending bursts get all the packets due now sent
+        // in one go, as long as there is no back pressure
+        bool more_packets;
+        do {
+            // get the next packet and try to send it
+            PacketPtr pkt = activeGenerator->getNextPacket();
 
-            pkt->req->setStreamId(sid);
+            // If generating stream/substream IDs are enabled,
+            // try to pick and assign them to the new packet
+            if (streamGenerator) {
+                auto sid = streamGenerator->pickStreamID();
+                auto ssid = streamGenerator->pickSubStreamID();
 
-            if (streamGenerator->ssidValid()) {
-                pkt->req->setSubStreamId(ssid);
-            }
-        }
+                pkt->req->setStreamId(sid);
 
-        // suppress packets that are not destined for a memory, such as
-        // device accesses that could be part of a trace
-        if (pkt && system->isMemAddr(pkt->getAddr())) {
-            stats.numPackets++;
-            // Only attempts to send if not blocked by pending responses
-            blockedWaitingResp = allocateWaitingRespSlot(pkt);
-            if (blockedWaitingResp || !port.sendTimingReq(pkt)) {
-                retryPkt = pkt;
-                retryPktTick = curTick();
+                if (streamGenerator->ssidValid()) {
+                    pkt->req->setSubStreamId(ssid);
+                }
             }
-        } else if (pkt) {
-            DPRINTF(TrafficGen, "Suppressed packet %s 0x%x\n",
-                    pkt->cmdString(), pkt->getAddr());
 
-            ++stats.numSuppressed;
-            if (!(static_cast<int>(stats.numSuppressed.value()) % 10000))
-                warn("%s suppressed %d packets with non-memory addresses\n",
-                     name(), stats.numSuppressed.value());
+            // suppress packets that are not destined for a memory, such as
+            // device accesses that could be part of a trace
+            if (pkt && system->isMemAddr(pkt->getAddr())) {
+                stats.numPackets++;
+                // Only attempts to send if not blocked by pending responses
+                blockedWaitingResp = allocateWaitingRespSlot(pkt);
+                if (blockedWaitingResp || !port.sendTimingReq(pkt)) {
+                    retryPkt = pkt;
+                    retryPktTick = curTick();
+                }
+            } else if (pkt) {
+                DPRINTF(TrafficGen, "Suppressed packet %s 0x%x\n",
+                        pkt->cmdString(), pkt->getAddr());
+
+                ++stats.numSuppressed;
+                if (!(static_cast<int>(stats.numSuppressed.value()) % 10000))
+                    warn("%s suppressed %d packets with non-memory "
+                         "addresses\n", name(), stats.numSuppressed.value());
+
+                delete pkt;
+                pkt = nullptr;
+            }
 
-            delete pkt;
-            pkt = nullptr;
-        }
+            more_packets = retryPkt == NULL &&
+                activeGenerator->burstsSameTick() &&
+                activeGenerator->nextPacketTick(elasticReq, 0) <= curTick();
+        } while (more_packets);
     }
 
     // if we are waiting for a retry or for a response, do not schedule any
@@ -527,6 +538,17 @@ BaseTrafficGen::createTrace(Tick duration,
 #endif
 }
 
+std::shared_ptr<BaseGen>
+BaseTrafficGen::createBinaryTrace(Tick duration,
+                                  const std::string& trace_file,
+                                  Addr addr_offset,
+                                  unsigned shard, unsigned num_shards)
+{
+    return std::shared_ptr<BaseGen>(
+        new BinaryTraceGen(*this, requestorId, duration, trace_file,
+                           addr_offset, shard, num_shards));
+}
+
 bool
 BaseTrafficGen::recvTimingResp(PacketPtr pkt)
 {
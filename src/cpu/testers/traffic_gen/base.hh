@@ -318,6 +318,11 @@ class BaseTrafficGen : public ClockedObject
         Tick duration,
         const std::string& trace_file, Addr addr_offset);
 
+    std::shared_ptr<BaseGen> createBinaryTrace(
+        Tick duration,
+        const std::string& trace_file, Addr addr_offset,
+        unsigned shard, unsigned num_shards);
+
   protected:
     void start();
 
@@ -127,6 +127,13 @@ class BaseGen
      */
     virtual Tick nextPacketTick(bool elastic, Tick delay) const = 0;
 
+    /**
+     * Should all the packets due at the same tick be sent in one go,
+     * rather than scheduling an update for each of them? This saves
+     * host time for generators issuing many packets per tick.
+     */
+    virtual bool burstsSameTick() const { return false; }
+
 };
 
 class StochasticGen : public BaseGen
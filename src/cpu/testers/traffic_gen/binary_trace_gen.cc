@@ -0,0 +1,182 @@
+/*
+ * Copyright (c) 2026 The gem5 Authors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "cpu/testers/traffic_gen/binary_trace_gen.hh"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cstring>
+
+#include "base/logging.hh"
+#include "base/trace.hh"
+#include "debug/TrafficGen.hh"
+#include "sim/core.hh"
+
+static_assert(sizeof(BinaryTraceGen::Header) == 32,
+              "Unexpected binary trace header size");
+static_assert(sizeof(BinaryTraceGen::Record) == 32,
+              "Unexpected binary trace record size");
+
+const char BinaryTraceGen::magic[8] = { 'g', 'e', 'm', '5', 'b', 'p', 't', 0 };
+const uint32_t BinaryTraceGen::version;
+
+BinaryTraceGen::BinaryTraceGen(SimObject &obj, RequestorID requestor_id,
+                               Tick _duration, const std::string& trace_file,
+                               Addr addr_offset, unsigned _shard,
+                               unsigned num_shards)
+    : BaseGen(obj, requestor_id, _duration),
+      map(nullptr), mapSize(0), records(nullptr), numRecords(0),
+      shard(_shard), numShards(num_shards), nextRecord(0), prefetched(0),
+      tickOffset(0), addrOffset(addr_offset)
+{
+    fatal_if(numShards == 0 || shard >= numShards,
+             "Invalid shard %d of %d for trace %s\n", shard, numShards,
+             trace_file);
+
+    int fd = open(trace_file.c_str(), O_RDONLY);
+    fatal_if(fd == -1, "Failed to open trace %s\n", trace_file);
+
+    struct stat st;
+    if (fstat(fd, &st) == -1 || (size_t)st.st_size < sizeof(Header)) {
+        close(fd);
+        fatal("Trace %s is too short\n", trace_file);
+    }
+
+    mapSize = st.st_size;
+    void *addr = mmap(nullptr, mapSize, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    fatal_if(addr == MAP_FAILED, "Failed to mmap trace %s\n", trace_file);
+    map = (uint8_t *)addr;
+
+    // the records are only read front to back
+    madvise(map, mapSize, MADV_SEQUENTIAL);
+
+    Header header;
+    std::memcpy(&header, map, sizeof(header));
+    fatal_if(std::memcmp(header.magic, magic, sizeof(magic)) != 0,
+             "%s is not a binary packet trace\n", trace_file);
+    fatal_if(header.version != version || header.recordSize != sizeof(Record),
+             "Trace %s has an unsupported version %d or record size %d\n",
+             trace_file, header.version, header.recordSize);
+    fatal_if(header.tickFreq != SimClock::Frequency,
+             "Trace was recorded with a different tick frequency %d\n",
+             header.tickFreq);
+    fatal_if(header.numRecords > (mapSize - sizeof(Header)) / sizeof(Record),
+             "Trace %s is truncated\n", trace_file);
+
+    records = (const Record *)(map + sizeof(Header));
+    numRecords = header.numRecords;
+}
+
+BinaryTraceGen::~BinaryTraceGen()
+{
+    if (map)
+        munmap(map, mapSize);
+}
+
+void
+BinaryTraceGen::prefetch()
+{
+    uint64_t end = std::min(nextRecord + prefetchRecords * numShards,
+                            numRecords);
+    if (end <= prefetched)
+        return;
+
+    uint64_t start = std::max(prefetched, nextRecord);
+    uintptr_t page_mask = ~((uintptr_t)sysconf(_SC_PAGESIZE) - 1);
+    uintptr_t from = (uintptr_t)&records[start] & page_mask;
+    uintptr_t to = (uintptr_t)&records[end];
+    madvise((void *)from, to - from, MADV_WILLNEED);
+
+    prefetched = end;
+}
+
+Tick
+BinaryTraceGen::nextPacketTick(bool elastic, Tick delay) const
+{
+    if (nextRecord >= numRecords) {
+        DPRINTF(TrafficGen, "No next tick as trace is finished\n");
+        return MaxTick;
+    }
+
+    // if the playback is supposed to be elastic, add the delay
+    if (elastic)
+        tickOffset += delay;
+
+    return std::max(tickOffset + records[nextRecord].tick, curTick());
+}
+
+void
+BinaryTraceGen::enter()
+{
+    // update the trace offset to the time where the state was entered.
+    tickOffset = curTick();
+
+    nextRecord = shard;
+    prefetched = 0;
+    prefetch();
+}
+
+PacketPtr
+BinaryTraceGen::getNextPacket()
+{
+    assert(nextRecord < numRecords);
+    const Record &rec = records[nextRecord];
+    fatal_if(rec.cmd >= MemCmd::NUM_MEM_CMDS,
+             "Invalid command %d in trace of %s\n", rec.cmd, name());
+
+    nextRecord += numShards;
+    if (nextRecord + prefetchRecords * numShards / 2 >= prefetched)
+        prefetch();
+
+    DPRINTF(TrafficGen, "BinaryTraceGen::getNextPacket: %s %d %d %d 0x%x\n",
+            MemCmd((MemCmd::Command)rec.cmd).toString(), rec.addr, rec.size,
+            rec.tick, rec.flags);
+
+    return getPacket(rec.addr + addrOffset, rec.size,
+                     MemCmd((MemCmd::Command)rec.cmd), rec.flags);
+}
+
+void
+BinaryTraceGen::exit()
+{
+    // Check if we reached the end of the trace file. If we did not
+    // then we want to generate a warning stating that not the entire
+    // trace was played.
+    if (nextRecord < numRecords) {
+        warn("Trace player %s was unable to replay the entire trace!\n",
+             name());
+    }
+
+    // start over again from the beginning of the trace
+    nextRecord = shard;
+}
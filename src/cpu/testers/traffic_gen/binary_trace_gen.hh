@@ -0,0 +1,157 @@
+/*
+ * Copyright (c) 2026 The gem5 Authors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * Declaration of a generator replaying a binary packet trace.
+ */
+
+#ifndef __CPU_TRAFFIC_GEN_BINARY_TRACE_GEN_HH__
+#define __CPU_TRAFFIC_GEN_BINARY_TRACE_GEN_HH__
+
+#include <cstdint>
+#include <string>
+
+#include "base_gen.hh"
+#include "mem/packet.hh"
+
+/**
+ * The binary trace replay generator plays back a packet trace of
+ * fixed-size records. Unlike the TraceGen, which decodes a
+ * gzip-compressed protobuf message per packet, the trace is mapped
+ * into memory and its records are used in place, and all the packets
+ * due at the same tick are sent in one go.
+ *
+ * A trace can be split over several generators, e.g. one per port, by
+ * giving each of them a different shard: generator i of n replays the
+ * records i, i + n, i + 2n, ... with their original timing.
+ *
+ * Traces are created from protobuf packet traces with
+ * util/encode_binary_packet_trace.py.
+ */
+class BinaryTraceGen : public BaseGen
+{
+
+  public:
+
+    /** File header, in host byte order. */
+    struct Header
+    {
+        char magic[8];
+        uint32_t version;
+        uint32_t recordSize;
+        uint64_t tickFreq;
+        uint64_t numRecords;
+    };
+
+    /** A packet of the trace. */
+    struct Record
+    {
+        uint64_t tick;
+        uint64_t addr;
+        uint64_t flags;
+        uint32_t size;
+        uint32_t cmd;
+    };
+
+    static const char magic[8];
+    static const uint32_t version = 1;
+
+    /**
+     * Create a binary trace generator.
+     *
+     * @param obj SimObject owning this generator
+     * @param requestor_id RequestorID set on each request
+     * @param _duration duration of this state before transitioning
+     * @param trace_file File to read the trace from
+     * @param addr_offset Positive offset to add to trace address
+     * @param shard Index of the records replayed by this generator
+     * @param num_shards Number of generators the trace is split over
+     */
+    BinaryTraceGen(SimObject &obj, RequestorID requestor_id, Tick _duration,
+                   const std::string& trace_file, Addr addr_offset,
+                   unsigned shard = 0, unsigned num_shards = 1);
+
+    ~BinaryTraceGen();
+
+    void enter();
+
+    PacketPtr getNextPacket();
+
+    void exit();
+
+    /**
+     * Returns the tick when the next request should be generated. If
+     * the end of the trace has been reached, it returns MaxTick to
+     * indicate that there will be no more requests.
+     */
+    Tick nextPacketTick(bool elastic, Tick delay) const;
+
+    bool burstsSameTick() const { return true; }
+
+  private:
+
+    /**
+     * Ask the host to start reading the next part of the trace, so
+     * that replaying it doesn't wait for the disk.
+     */
+    void prefetch();
+
+    /** Number of records read ahead of the replay position. */
+    static const uint64_t prefetchRecords = 1 << 16;
+
+    /** The memory mapped trace file. */
+    uint8_t *map;
+    size_t mapSize;
+
+    const Record *records;
+    uint64_t numRecords;
+
+    const unsigned shard;
+    const unsigned numShards;
+
+    /** Index of the next record to replay. */
+    uint64_t nextRecord;
+
+    /** Index up to which the records have been prefetched. */
+    uint64_t prefetched;
+
+    /**
+     * Stores the time when the state was entered. This is to add an
+     * offset to the times stored in the trace file. This is mutable
+     * to allow us to change it as part of nextPacketTick.
+     */
+    mutable Tick tickOffset;
+
+    /** Offset for memory requests. Used to shift the trace away from
+     * the CPU address space.
+     */
+    const Addr addrOffset;
+};
+
+#endif
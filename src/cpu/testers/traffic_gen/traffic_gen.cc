@@ -175,6 +175,33 @@ TrafficGen::parseConfig()
 
                     states[id] = createTrace(duration, traceFile, addrOffset);
                     DPRINTF(TrafficGen, "State: %d TraceGen\n", id);
+                } else if (mode == "BINARY_TRACE") {
+                    string traceFile;
+                    Addr addrOffset;
+                    unsigned shard = 0;
+                    unsigned numShards = 1;
+
+                    is >> traceFile >> addrOffset;
+                    if (is.fail()) {
+                        fatal("%s: BINARY_TRACE state %d needs a trace "
+                              "file and an address offset\n", name(), id);
+                    }
+
+                    // the shard is optional, but needs both values
+                    if (!(is >> ws).eof()) {
+                        is >> shard >> numShards;
+                        if (is.fail() || !(is >> ws).eof()) {
+                            fatal("%s: BINARY_TRACE state %d expects "
+                                  "either no shard or a shard and the "
+                                  "number of shards\n", name(), id);
+                        }
+                    }
+                    traceFile = resolveFile(traceFile);
+
+                    states[id] = createBinaryTrace(duration, traceFile,
+                                                   addrOffset, shard,
+                                                   numShards);
+                    DPRINTF(TrafficGen, "State: %d BinaryTraceGen\n", id);
                 } else if (mode == "IDLE") {
                     states[id] = createIdle(duration);
                     DPRINTF(TrafficGen, "State: %d IdleGen\n", id);
@@ -94,6 +94,11 @@ class BaseXBar(ClockedObject):
     use_default_range = Param.Bool(False, "Perform address mapping for " \
                                        "the default port")
 
+    # The routing table of outstanding requests is preallocated to hold
+    # this many entries, and only grows (allocating memory) beyond it
+    route_table_size = Param.Unsigned(512, "Expected number of outstanding "
+                                      "requests in the routing table")
+
 class NoncoherentXBar(BaseXBar):
     type = 'NoncoherentXBar'
     cxx_header = "mem/noncoherent_xbar.hh"
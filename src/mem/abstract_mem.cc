@@ -133,7 +133,17 @@ AbstractMemory::MemStats::MemStats(AbstractMemory &_mem)
     bwWrite(this, "bw_write",
             "Write bandwidth from this memory (bytes/s)"),
     bwTotal(this, "bw_total",
-            "Total bandwidth to/from this memory (bytes/s)")
+            "Total bandwidth to/from this memory (bytes/s)"),
+    numLockedAddrSets(this, "num_locked_addr_sets",
+                      "Number of load-locked reservations set"),
+    numLockedAddrChecks(this, "num_locked_addr_checks",
+                        "Number of writes checked against reservations"),
+    numLockedAddrHits(this, "num_locked_addr_hits",
+                      "Number of writes to a reserved address"),
+    numLockedAddrClears(this, "num_locked_addr_clears",
+                        "Number of reservations cleared by writes"),
+    lockedAddrHitRate(this, "locked_addr_hit_rate",
+                      "Fraction of checked writes to a reserved address")
 {
 }
 
@@ -236,6 +246,14 @@ AbstractMemory::MemStats::regStats()
     bwInstRead = bytesInstRead / simSeconds;
     bwWrite = bytesWritten / simSeconds;
     bwTotal = (bytesRead + bytesWritten) / simSeconds;
+
+    numLockedAddrSets.flags(nozero);
+    numLockedAddrChecks.flags(nozero);
+    numLockedAddrHits.flags(nozero);
+    numLockedAddrClears.flags(nozero);
+    lockedAddrHitRate.flags(nozero | nonan);
+
+    lockedAddrHitRate = numLockedAddrHits / numLockedAddrChecks;
 }
 
 AddrRange
@@ -244,7 +262,71 @@ AbstractMemory::getAddrRange() const
     return range;
 }
 
-// Add load-locked to tracking list.  Should only be called if the
+void
+AbstractMemory::setLockedAddr(ContextID cid, Addr paddr)
+{
+    assert(cid != InvalidContextID);
+    if (cid >= contextLockedAddr.size()) {
+        contextLockedAddr.resize(cid + 1, MaxAddr);
+    }
+
+    // Each context only gets one reservation, drop the previous one
+    const Addr old_paddr = contextLockedAddr[cid];
+    if (old_paddr != MaxAddr) {
+        auto it = lockedAddrTable.find(old_paddr);
+        assert(it != lockedAddrTable.end() && it->second > 0);
+        if (--it->second == 0) {
+            lockedAddrTable.erase(it);
+        }
+    }
+
+    contextLockedAddr[cid] = paddr;
+    lockedAddrTable[paddr]++;
+}
+
+void
+AbstractMemory::clearLockedAddr(Addr paddr, ContextID requestor_cid)
+{
+    auto it = lockedAddrTable.find(paddr);
+    assert(it != lockedAddrTable.end());
+    unsigned num_owners = it->second;
+    lockedAddrTable.erase(it);
+
+    // Contexts are scanned only when a write actually hits a
+    // reservation, and the scan stops once all owners are found
+    for (ContextID owner_cid = 0;
+         num_owners > 0 && owner_cid < contextLockedAddr.size();
+         ++owner_cid) {
+        if (contextLockedAddr[owner_cid] != paddr) {
+            continue;
+        }
+
+        DPRINTF(LLSC, "Erasing lock record: context %d addr %#x\n",
+                owner_cid, paddr);
+        if (owner_cid != requestor_cid) {
+            ThreadContext* ctx = system()->threads[owner_cid];
+            TheISA::globalClearExclusive(ctx);
+        }
+        contextLockedAddr[owner_cid] = MaxAddr;
+        stats.numLockedAddrClears++;
+        num_owners--;
+    }
+    assert(num_owners == 0);
+}
+
+list<LockedAddr>
+AbstractMemory::getLockedAddrList() const
+{
+    list<LockedAddr> locked_addrs;
+    for (ContextID cid = 0; cid < contextLockedAddr.size(); ++cid) {
+        if (contextLockedAddr[cid] != MaxAddr) {
+            locked_addrs.emplace_back(contextLockedAddr[cid], cid);
+        }
+    }
+    return locked_addrs;
+}
+
+// Add load-locked to tracking table.  Should only be called if the
 // operation is a load and the LLSC flag is set.
 void
 AbstractMemory::trackLoadLocked(PacketPtr pkt)
@@ -252,24 +334,12 @@ AbstractMemory::trackLoadLocked(PacketPtr pkt)
     const RequestPtr &req = pkt->req;
     Addr paddr = LockedAddr::mask(req->getPaddr());
 
-    // first we check if we already have a locked addr for this
-    // xc.  Since each xc only gets one, we just update the
-    // existing record with the new address.
-    list<LockedAddr>::iterator i;
-
-    for (i = lockedAddrList.begin(); i != lockedAddrList.end(); ++i) {
-        if (i->matchesContext(req)) {
-            DPRINTF(LLSC, "Modifying lock record: context %d addr %#x\n",
-                    req->contextId(), paddr);
-            i->addr = paddr;
-            return;
-        }
-    }
-
-    // no record for this xc: need to allocate a new one
-    DPRINTF(LLSC, "Adding lock record: context %d addr %#x\n",
+    // Since each xc only gets one reservation, a new record simply
+    // replaces any existing one.
+    DPRINTF(LLSC, "Setting lock record: context %d addr %#x\n",
             req->contextId(), paddr);
-    lockedAddrList.push_front(LockedAddr(req));
+    setLockedAddr(req->contextId(), paddr);
+    stats.numLockedAddrSets++;
 }
 
 
@@ -289,54 +359,39 @@ AbstractMemory::checkLockedAddrList(PacketPtr pkt)
     // otherwise.
     bool allowStore = !isLLSC;
 
-    // Iterate over list.  Note that there could be multiple matching records,
-    // as more than one context could have done a load locked to this location.
-    // Only remove records when we succeed in finding a record for (xc, addr);
-    // then, remove all records with this address.  Failed store-conditionals do
-    // not blow unrelated reservations.
-    list<LockedAddr>::iterator i = lockedAddrList.begin();
+    // Several contexts could have done a load locked to this
+    // location. Only remove records when we succeed in finding a
+    // record for (xc, addr); then, remove all records with this
+    // address.  Failed store-conditionals do not blow unrelated
+    // reservations.
+    const bool locked = lockedAddrTable.count(paddr);
+    stats.numLockedAddrChecks++;
+    if (locked) {
+        stats.numLockedAddrHits++;
+    }
 
     if (isLLSC) {
-        while (i != lockedAddrList.end()) {
-            if (i->addr == paddr && i->matchesContext(req)) {
-                // it's a store conditional, and as far as the memory system can
-                // tell, the requesting context's lock is still valid.
-                DPRINTF(LLSC, "StCond success: context %d addr %#x\n",
-                        req->contextId(), paddr);
-                allowStore = true;
-                break;
-            }
-            // If we didn't find a match, keep searching!  Someone else may well
-            // have a reservation on this line here but we may find ours in just
-            // a little while.
-            i++;
+        assert(req->hasContextId());
+        const ContextID cid = req->contextId();
+        if (locked && cid < contextLockedAddr.size() &&
+            contextLockedAddr[cid] == paddr) {
+            // it's a store conditional, and as far as the memory system can
+            // tell, the requesting context's lock is still valid.
+            DPRINTF(LLSC, "StCond success: context %d addr %#x\n",
+                    cid, paddr);
+            allowStore = true;
         }
         req->setExtraData(allowStore ? 1 : 0);
     }
     // LLSCs that succeeded AND non-LLSC stores both fall into here:
-    if (allowStore) {
-        // We write address paddr.  However, there may be several entries with a
-        // reservation on this address (for other contextIds) and they must all
-        // be removed.
-        i = lockedAddrList.begin();
-        while (i != lockedAddrList.end()) {
-            if (i->addr == paddr) {
-                DPRINTF(LLSC, "Erasing lock record: context %d addr %#x\n",
-                        i->contextId, paddr);
-                ContextID owner_cid = i->contextId;
-                assert(owner_cid != InvalidContextID);
-                ContextID requestor_cid = req->hasContextId() ?
-                                           req->contextId() :
-                                           InvalidContextID;
-                if (owner_cid != requestor_cid) {
-                    ThreadContext* ctx = system()->threads[owner_cid];
-                    TheISA::globalClearExclusive(ctx);
-                }
-                i = lockedAddrList.erase(i);
-            } else {
-                i++;
-            }
-        }
+    if (allowStore && locked) {
+        // We write address paddr.  However, there may be several
+        // reservations on this address (for other contextIds) and
+        // they must all be removed.
+        ContextID requestor_cid = req->hasContextId() ?
+                                   req->contextId() :
+                                   InvalidContextID;
+        clearLockedAddr(paddr, requestor_cid);
     }
 
     return allowStore;
@@ -452,7 +507,9 @@ AbstractMemory::access(PacketPtr pkt)
         // no need to do anything
     } else if (pkt->isWrite()) {
         if (writeOK(pkt)) {
-            if (pmemAddr) {
+            // the writeback of a data-less cache points at the line in
+            // the backing store, so its data is already in place
+            if (pmemAddr && pkt->getConstPtr<uint8_t>() != host_addr) {
                 pkt->writeData(host_addr);
                 DPRINTF(MemoryAccess, "%s write due to %s\n",
                         __func__, pkt->print());
@@ -46,6 +46,10 @@
 #ifndef __MEM_ABSTRACT_MEMORY_HH__
 #define __MEM_ABSTRACT_MEMORY_HH__
 
+#include <list>
+#include <vector>
+
+#include "base/open_hash_map.hh"
 #include "mem/backdoor.hh"
 #include "mem/port.hh"
 #include "params/AbstractMemory.hh"
@@ -123,11 +127,26 @@ class AbstractMemory : public ClockedObject
     // Should KVM map this memory for the guest
     const bool kvmMap;
 
-    std::list<LockedAddr> lockedAddrList;
+    // Locked address of each execution context, indexed by context
+    // id, or MaxAddr if the context holds no reservation. Each
+    // context holds at most one reservation at a time.
+    std::vector<Addr> contextLockedAddr;
+
+    // Number of contexts holding a reservation on each locked
+    // address, so that stores only need a single lookup to know
+    // whether they hit any reservation
+    OpenHashMap<Addr, unsigned> lockedAddrTable;
+
+    // Record a reservation of a context, replacing its previous one
+    void setLockedAddr(ContextID cid, Addr paddr);
+
+    // Drop all the reservations on an address, clearing the
+    // exclusive monitor of all contexts other than the requestor
+    void clearLockedAddr(Addr paddr, ContextID requestor_cid);
 
     // helper function for checkLockedAddrs(): we really want to
-    // inline a quick check for an empty locked addr list (hopefully
-    // the common case), and do the full list search (if necessary) in
+    // inline a quick check for an empty locked addr table (hopefully
+    // the common case), and do the table lookup (if necessary) in
     // this out-of-line function
     bool checkLockedAddrList(PacketPtr pkt);
 
@@ -145,7 +164,7 @@ class AbstractMemory : public ClockedObject
     // non-conditional stores must clear any matching lock addresses.
     bool writeOK(PacketPtr pkt) {
         const RequestPtr &req = pkt->req;
-        if (lockedAddrList.empty()) {
+        if (lockedAddrTable.empty()) {
             // no locked addrs: nothing to check, store_conditional fails
             bool isLLSC = pkt->isLLSC();
             if (isLLSC) {
@@ -153,7 +172,7 @@ class AbstractMemory : public ClockedObject
             }
             return !isLLSC; // only do write if not an sc
         } else {
-            // iterate over list...
+            // look up the reservations...
             return checkLockedAddrList(pkt);
         }
     }
@@ -191,6 +210,16 @@ class AbstractMemory : public ClockedObject
         Stats::Formula bwWrite;
         /** Total bandwidth from this memory */
         Stats::Formula bwTotal;
+        /** Number of load-locked reservations set */
+        Stats::Scalar numLockedAddrSets;
+        /** Number of writes checked against outstanding reservations */
+        Stats::Scalar numLockedAddrChecks;
+        /** Number of writes to an address holding a reservation */
+        Stats::Scalar numLockedAddrHits;
+        /** Number of reservations cleared by writes */
+        Stats::Scalar numLockedAddrClears;
+        /** Fraction of checked writes hitting a reservation */
+        Stats::Formula lockedAddrHitRate;
     } stats;
 
 
@@ -230,13 +259,16 @@ class AbstractMemory : public ClockedObject
     /**
      * Get the list of locked addresses to allow checkpointing.
      */
-    const std::list<LockedAddr>& getLockedAddrList() const
-    { return lockedAddrList; }
+    std::list<LockedAddr> getLockedAddrList() const;
 
     /**
      * Add a locked address to allow for checkpointing.
      */
-    void addLockedAddr(LockedAddr addr) { lockedAddrList.push_back(addr); }
+    void
+    addLockedAddr(LockedAddr addr)
+    {
+        setLockedAddr(addr.contextId, addr.addr);
+    }
 
     /** read the system pointer
      * Implemented for completeness with the setter
@@ -385,6 +385,28 @@ Bridge::BridgeRequestPort::trySatisfyFunctional(PacketPtr pkt)
     return found;
 }
 
+bool
+Bridge::BridgeResponsePort::findHeldLines(Addr addr, Addr size,
+                                          std::vector<Addr> &lines) const
+{
+    for (const auto &p : transmitList) {
+        if (carriesData(p.pkt, addr, size))
+            return false;
+    }
+    return true;
+}
+
+bool
+Bridge::BridgeRequestPort::findHeldLines(Addr addr, Addr size,
+                                         std::vector<Addr> &lines) const
+{
+    for (const auto &p : transmitList) {
+        if (carriesData(p.pkt, addr, size))
+            return false;
+    }
+    return true;
+}
+
 AddrRangeList
 Bridge::BridgeResponsePort::getAddrRanges() const
 {
@@ -50,6 +50,7 @@
 #include <deque>
 
 #include "base/types.hh"
+#include "mem/functional_data_holder.hh"
 #include "mem/port.hh"
 #include "params/Bridge.hh"
 #include "sim/clocked_object.hh"
@@ -96,7 +97,8 @@ class Bridge : public ClockedObject
      * is responsible for. The response port also has a buffer for the
      * responses not yet sent.
      */
-    class BridgeResponsePort : public ResponsePort
+    class BridgeResponsePort : public ResponsePort,
+                               public FunctionalDataHolder
     {
 
       private:
@@ -188,6 +190,13 @@ class Bridge : public ClockedObject
          */
         void retryStalledReq();
 
+        /**
+         * Report that the bridge cannot tell which lines are held if a
+         * queued response carries data of the range.
+         */
+        bool findHeldLines(Addr addr, Addr size,
+                           std::vector<Addr> &lines) const override;
+
       protected:
 
         /** When receiving a timing request from the peer port,
@@ -217,7 +226,8 @@ class Bridge : public ClockedObject
      * responses. The request port has a buffer for the requests not
      * yet sent.
      */
-    class BridgeRequestPort : public RequestPort
+    class BridgeRequestPort : public RequestPort,
+                              public FunctionalDataHolder
     {
 
       private:
@@ -296,6 +306,13 @@ class Bridge : public ClockedObject
          */
         bool trySatisfyFunctional(PacketPtr pkt);
 
+        /**
+         * Report that the bridge cannot tell which lines are held if a
+         * queued request carries data of the range.
+         */
+        bool findHeldLines(Addr addr, Addr size,
+                           std::vector<Addr> &lines) const override;
+
       protected:
 
         /** When receiving a timing request from the peer port,
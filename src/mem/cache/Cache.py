@@ -104,6 +104,12 @@ class BaseCache(ClockedObject):
 
     compressor = Param.BaseCacheCompressor(NULL, "Cache compressor.")
 
+    # Bandwidth-only mode: blocks keep tags and coherence state, and
+    # alias the backing store of physical memory instead of holding a
+    # private copy of the data. All caches in a hierarchy must agree.
+    data_less = Param.Bool(False, "Keep no data in the cache and access "
+        "the physical memory backing store in place")
+
     sequential_access = Param.Bool(False,
         "Whether to access tags and data sequentially")
 
@@ -84,6 +84,7 @@ BaseCache::BaseCache(const BaseCacheParams *p, unsigned blk_size)
       prefetcher(p->prefetcher),
       writeAllocator(p->write_allocator),
       writebackClean(p->writeback_clean),
+      dataLess(p->data_less),
       tempBlockWriteback(nullptr),
       writebackTempBlockAtomicEvent([this]{ writebackTempBlockAtomic(); },
                                     name(), false,
@@ -116,6 +117,11 @@ BaseCache::BaseCache(const BaseCacheParams *p, unsigned blk_size)
     // forward snoops is overridden in init() once we can query
     // whether the connected requestor is actually snooping or not
 
+    fatal_if(dataLess && compressor, "%s: data-less caches cannot use a "
+             "compressor.\n", name());
+    fatal_if(dataLess != tags->isDataLess(), "%s: the cache and its tags "
+             "must agree on data_less.\n", name());
+
     tempBlock = new TempCacheBlk(blkSize);
 
     tags->tagsInit();
@@ -182,6 +188,22 @@ BaseCache::init()
         fatal("Cache ports on %s are not connected\n", name());
     cpuSidePort.sendRangeChange();
     forwardSnoops = cpuSidePort.isSnooping();
+
+    if (dataLess) {
+        backingStore = system->getPhysMem().getBackingStore();
+    }
+}
+
+uint8_t *
+BaseCache::hostLineData(Addr blk_addr) const
+{
+    for (const auto &entry : backingStore) {
+        if (entry.range.contains(blk_addr)) {
+            return entry.pmem + (blk_addr - entry.range.start());
+        }
+    }
+    fatal("%s: no backing store for line %#llx in data-less mode.\n",
+          name(), blk_addr);
 }
 
 Port &
@@ -207,6 +229,38 @@ BaseCache::inRange(Addr addr) const
     return false;
 }
 
+bool
+BaseCache::findHeldLines(Addr addr, Addr size,
+                         std::vector<Addr> &lines) const
+{
+    if (cpuSidePort.hasQueuedPackets() || memSidePort.hasQueuedPackets() ||
+        tempBlock->isValid()) {
+        return false;
+    }
+
+    // Most of the time the queues are empty, and so is the whole
+    // cache when loading memory at startup
+    const bool check_queues = !mshrQueue.isEmpty() || !writeBuffer.isEmpty();
+    if (!check_queues && tags->isEmpty()) {
+        return true;
+    }
+
+    const Addr end = addr + size;
+    for (Addr blk_addr = addr & ~Addr(blkSize - 1); blk_addr < end;
+         blk_addr += blkSize) {
+        for (const bool is_secure : {false, true}) {
+            if (tags->findBlock(blk_addr, is_secure) ||
+                (check_queues &&
+                 (mshrQueue.findMatch(blk_addr, is_secure) ||
+                  writeBuffer.findMatch(blk_addr, is_secure)))) {
+                lines.push_back(blk_addr);
+                break;
+            }
+        }
+    }
+    return true;
+}
+
 void
 BaseCache::handleTimingReqHit(PacketPtr pkt, CacheBlk *blk, Tick request_time)
 {
@@ -1164,7 +1218,17 @@ BaseCache::access(PacketPtr pkt, CacheBlk *&blk, Cycles &lat,
         }
         // nothing else to do; writeback doesn't expect response
         assert(!pkt->needsResponse());
-        pkt->writeDataToBlock(blk->data, blkSize);
+        if (!dataLess) {
+            pkt->writeDataToBlock(blk->data, blkSize);
+        } else {
+            // the writeback of a data-less cache points at the line in
+            // the backing store, which this block aliases too
+            panic_if(pkt->getConstPtr<uint8_t>() !=
+                     blk->data + pkt->getOffset(blkSize),
+                     "%s: writeback %s does not alias the line; caches "
+                     "above a data-less cache must be data-less.\n",
+                     name(), pkt->print());
+        }
         DPRINTF(Cache, "%s new state is %s\n", __func__, blk->print());
         incHitCount(pkt);
 
@@ -1237,7 +1301,17 @@ BaseCache::access(PacketPtr pkt, CacheBlk *&blk, Cycles &lat,
         }
         // nothing else to do; writeback doesn't expect response
         assert(!pkt->needsResponse());
-        pkt->writeDataToBlock(blk->data, blkSize);
+        if (!dataLess) {
+            pkt->writeDataToBlock(blk->data, blkSize);
+        } else {
+            // the writeback of a data-less cache points at the line in
+            // the backing store, which this block aliases too
+            panic_if(pkt->getConstPtr<uint8_t>() !=
+                     blk->data + pkt->getOffset(blkSize),
+                     "%s: writeback %s does not alias the line; caches "
+                     "above a data-less cache must be data-less.\n",
+                     name(), pkt->print());
+        }
         DPRINTF(Cache, "%s new state is %s\n", __func__, blk->print());
 
         incHitCount(pkt);
@@ -1331,6 +1405,9 @@ BaseCache::handleFill(PacketPtr pkt, CacheBlk *blk, PacketList &writebacks,
             // current request and then get rid of it
             blk = tempBlock;
             tempBlock->insert(addr, is_secure);
+            if (dataLess) {
+                tempBlock->data = hostLineData(addr);
+            }
             DPRINTF(Cache, "using temp block for %#llx (%s)\n", addr,
                     is_secure ? "s" : "ns");
         }
@@ -1390,7 +1467,11 @@ BaseCache::handleFill(PacketPtr pkt, CacheBlk *blk, PacketList &writebacks,
         assert(pkt->hasData());
         assert(pkt->getSize() == blkSize);
 
-        pkt->writeDataToBlock(blk->data, blkSize);
+        // a data-less block already aliases the backing store, which
+        // holds the most recent copy of the line
+        if (!dataLess) {
+            pkt->writeDataToBlock(blk->data, blkSize);
+        }
     }
     // The block will be ready when the payload arrives and the fill is done
     blk->setWhenReady(clockEdge(fillLatency) + pkt->headerDelay +
@@ -1452,6 +1533,9 @@ BaseCache::allocateBlock(const PacketPtr pkt, PacketList &writebacks)
 
     // Insert new block at victimized entry
     tags->insertBlock(pkt, victim);
+    if (dataLess) {
+        victim->data = hostLineData(pkt->getBlockAddr(blkSize));
+    }
 
     return victim;
 }
@@ -1518,8 +1602,14 @@ BaseCache::writebackBlk(CacheBlk *blk)
     // make sure the block is not marked dirty
     blk->status &= ~BlkDirty;
 
-    pkt->allocate();
-    pkt->setDataFromBlock(blk->data, blkSize);
+    if (dataLess) {
+        // point at the backing store so that the eventual write is a
+        // no-op and cannot clobber newer stores to the same line
+        pkt->dataStatic(blk->data);
+    } else {
+        pkt->allocate();
+        pkt->setDataFromBlock(blk->data, blkSize);
+    }
 
     // When a block is compressed, it must first be decompressed before being
     // sent for writeback.
@@ -1563,8 +1653,14 @@ BaseCache::writecleanBlk(CacheBlk *blk, Request::Flags dest, PacketId id)
     // make sure the block is not marked dirty
     blk->status &= ~BlkDirty;
 
-    pkt->allocate();
-    pkt->setDataFromBlock(blk->data, blkSize);
+    if (dataLess) {
+        // point at the backing store so that the eventual write is a
+        // no-op and cannot clobber newer stores to the same line
+        pkt->dataStatic(blk->data);
+    } else {
+        pkt->allocate();
+        pkt->setDataFromBlock(blk->data, blkSize);
+    }
 
     // When a block is compressed, it must first be decompressed before being
     // sent for writeback.
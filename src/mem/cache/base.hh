@@ -49,6 +49,7 @@
 #include <cassert>
 #include <cstdint>
 #include <string>
+#include <vector>
 
 #include "base/addr_range.hh"
 #include "base/statistics.hh"
@@ -63,8 +64,10 @@
 #include "mem/cache/tags/base.hh"
 #include "mem/cache/write_queue.hh"
 #include "mem/cache/write_queue_entry.hh"
+#include "mem/functional_data_holder.hh"
 #include "mem/packet.hh"
 #include "mem/packet_queue.hh"
+#include "mem/physical.hh"
 #include "mem/qport.hh"
 #include "mem/request.hh"
 #include "params/WriteAllocator.hh"
@@ -86,7 +89,7 @@ struct BaseCacheParams;
 /**
  * A basic cache interface. Implements some common functions for speed.
  */
-class BaseCache : public ClockedObject
+class BaseCache : public ClockedObject, public FunctionalDataHolder
 {
   protected:
     /**
@@ -134,6 +137,13 @@ class BaseCache : public ClockedObject
             reqQueue.schedSendEvent(time);
         }
 
+        /** Check if requests or snoop responses are waiting. */
+        bool
+        hasQueuedPackets() const
+        {
+            return reqQueue.size() || snoopRespQueue.size();
+        }
+
       protected:
 
         CacheRequestPort(const std::string &_name, BaseCache *_cache,
@@ -254,6 +264,9 @@ class BaseCache : public ClockedObject
 
         bool isBlocked() const { return blocked; }
 
+        /** Check if responses are waiting. */
+        bool hasQueuedPackets() const { return queue.size(); }
+
       protected:
 
         CacheResponsePort(const std::string &_name, BaseCache *_cache,
@@ -625,6 +638,29 @@ class BaseCache : public ClockedObject
      */
     const bool writebackClean;
 
+    /**
+     * Keep only tags and coherence state, and let every block alias
+     * the host storage of the physical memory that backs it. Loads
+     * and stores are applied in place, fills and incoming writebacks
+     * skip their payload copy, and outgoing writebacks reference the
+     * backing store rather than carrying a private copy of the line.
+     */
+    const bool dataLess;
+
+    /**
+     * Copy of the system's backing store map, used to find the host
+     * storage of a line when running data-less.
+     */
+    std::vector<BackingStoreEntry> backingStore;
+
+    /**
+     * Get a pointer to the host storage of a line in data-less mode.
+     *
+     * @param blk_addr Block aligned address of the line.
+     * @return Pointer to blkSize bytes of backing store.
+     */
+    uint8_t *hostLineData(Addr blk_addr) const;
+
     /**
      * Writebacks from the tempBlock, resulting on the response path
      * in atomic mode, must happen after the call to recvAtomic has
@@ -1217,6 +1253,14 @@ class BaseCache : public ClockedObject
         return mshrQueue.findMatch(addr, is_secure);
     }
 
+    /**
+     * Find the lines of a range held in the tags, MSHRs or write
+     * buffer. Any packet waiting in the ports may carry data of any
+     * line, in which case the cache cannot tell.
+     */
+    bool findHeldLines(Addr addr, Addr size,
+                       std::vector<Addr> &lines) const override;
+
     void incMissCount(PacketPtr pkt)
     {
         assert(pkt->req->requestorId() < system->maxRequestors());
@@ -446,18 +446,24 @@ class TempCacheBlk final : public CacheBlk
      */
     Addr _addr;
 
+    /**
+     * Storage owned by this block. Data-less caches repoint data at
+     * the backing store, so keep track of what must be freed.
+     */
+    uint8_t *const storage;
+
   public:
     /**
      * Creates a temporary cache block, with its own storage.
      * @param size The size (in bytes) of this cache block.
      */
-    TempCacheBlk(unsigned size) : CacheBlk()
+    TempCacheBlk(unsigned size) : CacheBlk(), storage(new uint8_t[size])
     {
-        data = new uint8_t[size];
+        data = storage;
     }
     TempCacheBlk(const TempCacheBlk&) = delete;
     TempCacheBlk& operator=(const TempCacheBlk&) = delete;
-    ~TempCacheBlk() { delete [] data; };
+    ~TempCacheBlk() { delete [] storage; };
 
     /**
      * Invalidate the block and clear all state.
@@ -40,6 +40,9 @@ class BaseCacheCompressor(SimObject):
     size_threshold_percentage = Param.Percent(50,
         "Minimum percentage of the block size, a compressed block must "
         "achieve to be stored in compressed format")
+    memo_size = Param.Unsigned(0, "Number of entries of the memo of recent "
+        "compression results. Compressions of contents found in the memo "
+        "skip the compressor (and its pattern/ranking stats). 0 disables it")
 
 class BaseDictionaryCompressor(BaseCacheCompressor):
     type = 'BaseDictionaryCompressor'
@@ -36,6 +36,7 @@
 #include <climits>
 #include <cmath>
 #include <cstdint>
+#include <cstring>
 #include <string>
 
 #include "base/trace.hh"
@@ -78,6 +79,8 @@ Base::CompressionData::getSize() const
 Base::Base(const Params *p)
   : SimObject(p), blkSize(p->block_size), chunkSizeBits(p->chunk_size_bits),
     sizeThreshold((blkSize * p->size_threshold_percentage) / 100),
+    memoSize(p->memo_size), memo(memoSize),
+    memoData(memoSize * blkSize / sizeof(uint64_t)),
     stats(*this)
 {
     fatal_if(64 % chunkSizeBits,
@@ -93,6 +96,11 @@ Base::toChunks(const uint64_t* data) const
     const unsigned num_chunks_per_64 =
         (sizeof(uint64_t) * CHAR_BIT) / chunkSizeBits;
 
+    // If chunks are qwords there is nothing to split
+    if (chunkSizeBits == sizeof(uint64_t) * CHAR_BIT) {
+        return std::vector<Chunk>(data, data + blkSize / sizeof(uint64_t));
+    }
+
     // Turn a 64-bit array into a chunkSizeBits-array
     std::vector<Chunk> chunks((blkSize * CHAR_BIT) / chunkSizeBits, 0);
     for (int i = 0; i < chunks.size(); i++) {
@@ -122,12 +130,52 @@ Base::fromChunks(const std::vector<Chunk>& chunks, uint64_t* data) const
     }
 }
 
+std::size_t
+Base::memoIndex(const uint64_t* data) const
+{
+    uint64_t hash = 0;
+    for (std::size_t i = 0; i < blkSize / sizeof(uint64_t); i++) {
+        hash = (hash ^ data[i]) * 0x9E3779B97F4A7C15ULL;
+        hash ^= hash >> 32;
+    }
+    return hash % memoSize;
+}
+
 std::unique_ptr<Base::CompressionData>
 Base::compress(const uint64_t* data, Cycles& comp_lat, Cycles& decomp_lat)
 {
-    // Apply compression
-    std::unique_ptr<CompressionData> comp_data =
-        compress(toChunks(data), comp_lat, decomp_lat);
+    std::unique_ptr<CompressionData> comp_data;
+
+    // Search the memo for a previous compression of the same contents
+    MemoEntry* memo_entry = nullptr;
+    uint64_t* memo_data = nullptr;
+    if (memoSize) {
+        const std::size_t index = memoIndex(data);
+        memo_entry = &memo[index];
+        memo_data = &memoData[index * blkSize / sizeof(uint64_t)];
+        if (memo_entry->valid && !std::memcmp(memo_data, data, blkSize)) {
+            comp_data.reset(new MemoCompData(data, blkSize));
+            comp_data->setSizeBits(memo_entry->sizeBits);
+            comp_lat = memo_entry->compLat;
+            decomp_lat = memo_entry->decompLat;
+            stats.memoHits++;
+        }
+    }
+
+    if (!comp_data) {
+        // Apply compression
+        comp_data = compress(toChunks(data), comp_lat, decomp_lat);
+
+        // Record the result in the memo
+        if (memo_entry) {
+            memo_entry->valid = true;
+            memo_entry->sizeBits = comp_data->getSizeBits();
+            memo_entry->compLat = comp_lat;
+            memo_entry->decompLat = decomp_lat;
+            std::memcpy(memo_data, data, blkSize);
+            stats.memoMisses++;
+        }
+    }
 
     // If we are in debug mode apply decompression just after the compression.
     // If the results do not match, we've got an error
@@ -135,7 +183,7 @@ Base::compress(const uint64_t* data, Cycles& comp_lat, Cycles& decomp_lat)
     uint64_t decomp_data[blkSize/8];
 
     // Apply decompression
-    decompress(comp_data.get(), decomp_data);
+    decompressData(comp_data.get(), decomp_data);
 
     // Check if decompressed line matches original cache line
     fatal_if(std::memcmp(data, decomp_data, blkSize),
@@ -168,6 +216,18 @@ Base::compress(const uint64_t* data, Cycles& comp_lat, Cycles& decomp_lat)
     return comp_data;
 }
 
+void
+Base::decompressData(const CompressionData* comp_data, uint64_t* cache_line)
+{
+    const MemoCompData* memo_comp_data =
+        dynamic_cast<const MemoCompData*>(comp_data);
+    if (memo_comp_data) {
+        std::memcpy(cache_line, memo_comp_data->getData(), blkSize);
+    } else {
+        decompress(comp_data, cache_line);
+    }
+}
+
 Cycles
 Base::getDecompressionLatency(const CacheBlk* blk)
 {
@@ -219,7 +279,11 @@ Base::BaseStats::BaseStats(Base& _compressor)
     avgCompressionSizeBits(this, "avg_compression_size_bits",
         "Average compression size, in bits"),
     decompressions(this, "total_decompressions",
-        "Total number of decompressions")
+        "Total number of decompressions"),
+    memoHits(this, "memo_hits",
+        "Number of compressions whose result was found in the memo"),
+    memoMisses(this, "memo_misses",
+        "Number of compressions whose result was not found in the memo")
 {
 }
 
@@ -242,6 +306,9 @@ Base::BaseStats::regStats()
 
     avgCompressionSizeBits.flags(Stats::total | Stats::nozero | Stats::nonan);
     avgCompressionSizeBits = compressionSizeBits / compressions;
+
+    memoHits.flags(Stats::nozero);
+    memoMisses.flags(Stats::nozero);
 }
 
 } // namespace Compressor
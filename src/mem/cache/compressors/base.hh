@@ -37,6 +37,7 @@
 #define __MEM_CACHE_COMPRESSORS_BASE_HH__
 
 #include <cstdint>
+#include <vector>
 
 #include "base/statistics.hh"
 #include "base/types.hh"
@@ -95,6 +96,45 @@ class Base : public SimObject
      */
     const std::size_t sizeThreshold;
 
+    /**
+     * An entry of the compression memo. It records the result of the
+     * compression of a recently seen block's contents.
+     */
+    struct MemoEntry
+    {
+        /** Whether this entry contains a valid result. */
+        bool valid = false;
+
+        /** Compressed size, in bits, before applying the size threshold. */
+        std::size_t sizeBits = 0;
+
+        /** Compression latency of the memoized result. */
+        Cycles compLat = Cycles(0);
+
+        /** Decompression latency of the memoized result. */
+        Cycles decompLat = Cycles(0);
+    };
+
+    /**
+     * Number of entries of the direct-mapped compression memo. Repeated
+     * compressions of identical contents (e.g., zero-filled or copied pages)
+     * find their result there and skip recompression. The memo is disabled
+     * if this is 0.
+     */
+    const std::size_t memoSize;
+
+    /** The memo entries. */
+    std::vector<MemoEntry> memo;
+
+    /** Compression data of a result that was found in the memo. */
+    class MemoCompData;
+
+    /**
+     * Copy of the contents of each memoized block, used to verify hits.
+     * Entry i's contents are located at [i * blkSize, (i + 1) * blkSize).
+     */
+    std::vector<uint64_t> memoData;
+
     struct BaseStats : public Stats::Group
     {
         const Base& compressor;
@@ -120,8 +160,22 @@ class Base : public SimObject
 
         /** Number of decompressions performed. */
         Stats::Scalar decompressions;
+
+        /** Number of compressions whose result was found in the memo. */
+        Stats::Scalar memoHits;
+
+        /** Number of compressions whose result was not in the memo. */
+        Stats::Scalar memoMisses;
     } stats;
 
+    /**
+     * Hash the contents of a block to select its memo entry.
+     *
+     * @param data The raw pointer to the block's contents.
+     * @return The index of the memo entry.
+     */
+    std::size_t memoIndex(const uint64_t* data) const;
+
     /**
      * This function splits the raw data into chunks, so that it can be
      * parsed by the compressor.
@@ -164,6 +218,16 @@ class Base : public SimObject
     virtual void decompress(const CompressionData* comp_data,
                               uint64_t* cache_line) = 0;
 
+    /**
+     * Decompress the compressed data, which may have been produced by this
+     * compressor or found in its memo.
+     *
+     * @param comp_data Compressed cache line.
+     * @param cache_line The cache line to be decompressed.
+     */
+    void decompressData(const CompressionData* comp_data,
+                        uint64_t* cache_line);
+
   public:
     typedef BaseCacheCompressorParams Params;
     Base(const Params *p);
@@ -173,6 +237,11 @@ class Base : public SimObject
      * Apply the compression process to the cache line. Ignores compression
      * cycles.
      *
+     * When the memo is enabled and a block with identical contents has been
+     * compressed recently, the memoized result is returned instead. Such a
+     * result holds a copy of the uncompressed contents instead of the
+     * compressor's encoding; it is decompressed by decompressData().
+     *
      * @param data The cache line to be compressed.
      * @param comp_lat Compression latency in number of cycles.
      * @param decomp_lat Decompression latency in number of cycles.
@@ -247,6 +316,26 @@ class Base::CompressionData
     std::size_t getSize() const;
 };
 
+class Base::MemoCompData : public CompressionData
+{
+  private:
+    /** Copy of the uncompressed contents of the block. */
+    const std::vector<uint64_t> blkData;
+
+  public:
+    /**
+     * @param data The uncompressed contents of the block.
+     * @param blk_size Size of the block, in bytes.
+     */
+    MemoCompData(const uint64_t* data, std::size_t blk_size)
+      : CompressionData(), blkData(data, data + blk_size / sizeof(uint64_t))
+    {
+    }
+
+    /** @return The uncompressed contents of the block. */
+    const uint64_t* getData() const { return blkData.data(); }
+};
+
 } // namespace Compressor
 
 #endif //__MEM_CACHE_COMPRESSORS_BASE_HH__
@@ -36,6 +36,7 @@
 #include "debug/CacheComp.hh"
 #include "mem/cache/compressors/base_delta.hh"
 #include "mem/cache/compressors/dictionary_compressor_impl.hh"
+#include "mem/cache/compressors/kernels.hh"
 
 namespace Compressor {
 
@@ -71,22 +72,34 @@ BaseDelta<BaseType, DeltaSizeBits>::compress(
     const std::vector<Base::Chunk>& chunks, Cycles& comp_lat,
     Cycles& decomp_lat)
 {
-    std::unique_ptr<Base::CompressionData> comp_data =
-        DictionaryCompressor<BaseType>::compress(chunks);
+    // Check beforehand whether the values fit in the bases, so that data
+    // that cannot be compressed skips the pattern matching
+    BaseType values[chunks.size()];
+    for (std::size_t i = 0; i < chunks.size(); i++) {
+        values[i] = chunks[i];
+    }
+    const bool fits =
+        Kernels::fitsBaseDelta(values, chunks.size(), DeltaSizeBits);
 
     // If there are more bases than the maximum, the compressor failed.
     // Otherwise, we have to take into account all bases that have not
     // been used, considering that there is an implicit zero base that
     // does not need to be added to the final size.
-    const int diff = DEFAULT_MAX_NUM_BASES -
-        DictionaryCompressor<BaseType>::numEntries;
-    if (diff < 0) {
-        comp_data->setSizeBits(DictionaryCompressor<BaseType>::blkSize * 8);
+    std::unique_ptr<Base::CompressionData> comp_data;
+    if (!fits) {
+        comp_data = DictionaryCompressor<BaseType>::template
+            compressIncompressible<PatternX>(chunks);
         DPRINTF(CacheComp, "Base%dDelta%d compression failed\n",
             8 * sizeof(BaseType), DeltaSizeBits);
-    } else if (diff > 0) {
-        comp_data->setSizeBits(comp_data->getSizeBits() +
-            8 * sizeof(BaseType) * diff);
+    } else {
+        comp_data = DictionaryCompressor<BaseType>::compress(chunks);
+        const int diff = DEFAULT_MAX_NUM_BASES -
+            DictionaryCompressor<BaseType>::numEntries;
+        assert(diff >= 0);
+        if (diff > 0) {
+            comp_data->setSizeBits(comp_data->getSizeBits() +
+                8 * sizeof(BaseType) * diff);
+        }
     }
 
     // Set compression latency (Assumes 1 cycle per entry and 1 cycle for
@@ -46,7 +46,9 @@ BaseDictionaryCompressor::DictionaryStats::DictionaryStats(
     BaseStats& base_group, BaseDictionaryCompressor& _compressor)
   : Stats::Group(&base_group), compressor(_compressor),
     patterns(this, "pattern",
-        "Number of data entries that were compressed to this pattern")
+        "Number of data entries that were compressed to this pattern"),
+    fastRejections(this, "fast_rejections",
+        "Number of blocks found to be incompressible before pattern matching")
 {
 }
 
@@ -63,6 +65,8 @@ BaseDictionaryCompressor::DictionaryStats::regStats()
         patterns.subdesc(i, "Number of data entries that match pattern " +
             name);
     }
+
+    fastRejections.flags(Stats::nozero);
 }
 
 } // namespace Compressor
@@ -77,8 +77,17 @@ class BaseDictionaryCompressor : public Base
 
         void regStats() override;
 
-        /** Number of data entries that were compressed to each pattern. */
+        /**
+         * Number of data entries that were compressed to each pattern. Data
+         * discarded by a fast rejection is not accounted for.
+         */
         Stats::Vector patterns;
+
+        /**
+         * Number of blocks that were known to be incompressible before
+         * going through the pattern matching.
+         */
+        Stats::Scalar fastRejections;
     } dictionaryStats;
 
     /**
@@ -238,6 +247,20 @@ class DictionaryCompressor : public BaseDictionaryCompressor
     std::unique_ptr<Base::CompressionData> compress(
         const std::vector<Chunk>& chunks);
 
+    /**
+     * Generate the compression data of a block that is known to fail
+     * compression, without searching the dictionary. Every value is stored
+     * as an uncompressed pattern, so that it can still be decompressed, and
+     * the size is set to the uncompressed size.
+     *
+     * @tparam PatternX The compressor's uncompressed pattern.
+     * @param chunks The cache line to be compressed.
+     * @return Cache line after (failed) compression.
+     */
+    template <class PatternX>
+    std::unique_ptr<Base::CompressionData> compressIncompressible(
+        const std::vector<Chunk>& chunks);
+
     using BaseDictionaryCompressor::compress;
 
     /**
@@ -144,6 +144,30 @@ DictionaryCompressor<T>::compress(const std::vector<Chunk>& chunks)
     return comp_data;
 }
 
+template <class T>
+template <class PatternX>
+std::unique_ptr<Base::CompressionData>
+DictionaryCompressor<T>::compressIncompressible(
+    const std::vector<Chunk>& chunks)
+{
+    static_assert(std::is_base_of<UncompressedPattern, PatternX>::value,
+        "Incompressible data must use an uncompressed pattern.");
+
+    std::unique_ptr<Base::CompressionData> comp_data =
+        instantiateDictionaryCompData();
+
+    // Store every value as-is
+    CompData* const comp_data_ptr = static_cast<CompData*>(comp_data.get());
+    for (const auto& value : chunks) {
+        comp_data_ptr->addEntry(std::unique_ptr<Pattern>(
+            new PatternX(toDictionaryEntry(value), -1)));
+    }
+    comp_data->setSizeBits(blkSize * 8);
+    dictionaryStats.fastRejections++;
+
+    return comp_data;
+}
+
 template <class T>
 T
 DictionaryCompressor<T>::decompressValue(const Pattern* pattern)
@@ -0,0 +1,144 @@
+/*
+ * Copyright (c) 2026 The gem5 Authors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** @file
+ * Scalar implementation of the compressor kernels, and runtime selection of
+ * the best implementation supported by the host.
+ */
+
+#include "mem/cache/compressors/kernels.hh"
+
+#include "config/have_avx2.hh"
+#include "config/have_sse42.hh"
+#include "mem/cache/compressors/kernels_impl.hh"
+
+namespace Compressor {
+namespace Kernels {
+
+namespace {
+
+bool
+isZeroScalar(const uint64_t* data, std::size_t num_qwords)
+{
+    for (std::size_t i = 0; i < num_qwords; i++) {
+        if (data[i] != 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool
+isRepeatedScalar(const uint64_t* data, std::size_t num_qwords)
+{
+    for (std::size_t i = 1; i < num_qwords; i++) {
+        if (data[i] != data[0]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+} // anonymous namespace
+
+const Implementation scalarImplementation = {
+    "scalar",
+    &isZeroScalar,
+    &isRepeatedScalar,
+    &fitsBaseDeltaScalar<uint64_t>,
+    &fitsBaseDeltaScalar<uint32_t>,
+    &fitsBaseDeltaScalar<uint16_t>,
+};
+
+namespace {
+
+const Implementation&
+selectImplementation()
+{
+#if HAVE_AVX2 || HAVE_SSE42
+    __builtin_cpu_init();
+#endif
+#if HAVE_AVX2
+    if (__builtin_cpu_supports("avx2")) {
+        return avx2Implementation;
+    }
+#endif
+#if HAVE_SSE42
+    if (__builtin_cpu_supports("sse4.2")) {
+        return sse42Implementation;
+    }
+#endif
+    return scalarImplementation;
+}
+
+/** The implementation used by this host; selected once, at startup. */
+const Implementation& impl = selectImplementation();
+
+} // anonymous namespace
+
+bool
+isZero(const uint64_t* data, std::size_t num_qwords)
+{
+    return impl.isZero(data, num_qwords);
+}
+
+bool
+isRepeated(const uint64_t* data, std::size_t num_qwords)
+{
+    return impl.isRepeated(data, num_qwords);
+}
+
+bool
+fitsBaseDelta(const uint64_t* values, std::size_t num_values,
+    unsigned delta_bits)
+{
+    return impl.fitsBaseDelta64(values, num_values, delta_bits);
+}
+
+bool
+fitsBaseDelta(const uint32_t* values, std::size_t num_values,
+    unsigned delta_bits)
+{
+    return impl.fitsBaseDelta32(values, num_values, delta_bits);
+}
+
+bool
+fitsBaseDelta(const uint16_t* values, std::size_t num_values,
+    unsigned delta_bits)
+{
+    return impl.fitsBaseDelta16(values, num_values, delta_bits);
+}
+
+const char*
+implementationName()
+{
+    return impl.name;
+}
+
+} // namespace Kernels
+} // namespace Compressor
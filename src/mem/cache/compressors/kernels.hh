@@ -0,0 +1,92 @@
+/*
+ * Copyright (c) 2026 The gem5 Authors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** @file
+ * Vectorized helper kernels used by the compressors to quickly classify a
+ * cache line before going through the (expensive) pattern matching of the
+ * dictionary compressors. All kernels have a portable scalar version; when
+ * the host supports it, an SSE4.2 or AVX2 version is selected at runtime.
+ */
+
+#ifndef __MEM_CACHE_COMPRESSORS_KERNELS_HH__
+#define __MEM_CACHE_COMPRESSORS_KERNELS_HH__
+
+#include <cstddef>
+#include <cstdint>
+
+namespace Compressor {
+namespace Kernels {
+
+/**
+ * Check if all qwords of the given data are zero.
+ *
+ * @param data The data to be checked.
+ * @param num_qwords Number of qwords in data.
+ * @return Whether all qwords are zero.
+ */
+bool isZero(const uint64_t* data, std::size_t num_qwords);
+
+/**
+ * Check if all qwords of the given data are equal to the first one.
+ *
+ * @param data The data to be checked.
+ * @param num_qwords Number of qwords in data.
+ * @return Whether all qwords have the same value.
+ */
+bool isRepeated(const uint64_t* data, std::size_t num_qwords);
+
+/**
+ * Check if the values can be represented by a base-delta-immediate
+ * encoding with an implicit zero base and a single explicit base, that is,
+ * if every value is within a signed delta of delta_bits bits of either
+ * zero or of the first value that is not within such a delta of zero.
+ * This matches the acceptance criteria of the BaseDelta compressors.
+ *
+ * @param values The values to be checked.
+ * @param num_values Number of values.
+ * @param delta_bits Size of a delta, in bits.
+ * @return Whether the values are BDI-compressible.
+ */
+bool fitsBaseDelta(const uint64_t* values, std::size_t num_values,
+    unsigned delta_bits);
+bool fitsBaseDelta(const uint32_t* values, std::size_t num_values,
+    unsigned delta_bits);
+bool fitsBaseDelta(const uint16_t* values, std::size_t num_values,
+    unsigned delta_bits);
+
+/**
+ * Get the name of the kernel implementation that was selected for the host.
+ *
+ * @return "avx2", "sse4.2" or "scalar".
+ */
+const char* implementationName();
+
+} // namespace Kernels
+} // namespace Compressor
+
+#endif //__MEM_CACHE_COMPRESSORS_KERNELS_HH__
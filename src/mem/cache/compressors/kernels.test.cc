@@ -0,0 +1,221 @@
+/*
+ * Copyright (c) 2026 The gem5 Authors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include "config/have_avx2.hh"
+#include "config/have_sse42.hh"
+#include "mem/cache/compressors/kernels_impl.hh"
+
+using namespace Compressor::Kernels;
+
+namespace {
+
+/** Get the vector implementations that can be run on this host. */
+std::vector<const Implementation*>
+hostImplementations()
+{
+    std::vector<const Implementation*> impls;
+#if HAVE_AVX2 || HAVE_SSE42
+    __builtin_cpu_init();
+#endif
+#if HAVE_AVX2
+    if (__builtin_cpu_supports("avx2")) {
+        impls.push_back(&avx2Implementation);
+    }
+#endif
+#if HAVE_SSE42
+    if (__builtin_cpu_supports("sse4.2")) {
+        impls.push_back(&sse42Implementation);
+    }
+#endif
+    return impls;
+}
+
+/**
+ * Generate values that are either immediates, close to a common base, or
+ * random, with the given probabilities.
+ */
+template <class T>
+std::vector<T>
+generateValues(std::mt19937_64& rng, std::size_t num_values,
+    unsigned delta_bits, double immediate_prob, double random_prob)
+{
+    std::uniform_real_distribution<double> choice(0.0, 1.0);
+    const T base = static_cast<T>(rng());
+    const int64_t limit = delta_bits ? (int64_t(1) << (delta_bits - 1)) : 1;
+    std::uniform_int_distribution<int64_t> delta(-limit, limit);
+
+    std::vector<T> values(num_values);
+    for (auto& value : values) {
+        const double c = choice(rng);
+        if (c < immediate_prob) {
+            value = static_cast<T>(delta(rng));
+        } else if (c < immediate_prob + random_prob) {
+            value = static_cast<T>(rng());
+        } else {
+            value = static_cast<T>(base + delta(rng));
+        }
+    }
+    return values;
+}
+
+template <class T>
+bool
+fitsBaseDeltaOf(const Implementation& impl, const std::vector<T>& values,
+    unsigned delta_bits);
+
+template <>
+bool
+fitsBaseDeltaOf(const Implementation& impl,
+    const std::vector<uint64_t>& values, unsigned delta_bits)
+{
+    return impl.fitsBaseDelta64(values.data(), values.size(), delta_bits);
+}
+
+template <>
+bool
+fitsBaseDeltaOf(const Implementation& impl,
+    const std::vector<uint32_t>& values, unsigned delta_bits)
+{
+    return impl.fitsBaseDelta32(values.data(), values.size(), delta_bits);
+}
+
+template <>
+bool
+fitsBaseDeltaOf(const Implementation& impl,
+    const std::vector<uint16_t>& values, unsigned delta_bits)
+{
+    return impl.fitsBaseDelta16(values.data(), values.size(), delta_bits);
+}
+
+/**
+ * Compare the BDI check of all host implementations against the scalar
+ * reference on random blocks of values of type T.
+ */
+template <class T>
+void
+checkFitsBaseDelta(unsigned delta_bits)
+{
+    std::mt19937_64 rng(delta_bits * sizeof(T));
+    const double random_probs[] = {0.0, 0.01, 0.1, 0.5};
+    for (const Implementation* impl : hostImplementations()) {
+        for (std::size_t bytes = 8; bytes <= 256; bytes *= 2) {
+            const std::size_t num_values = bytes / sizeof(T);
+            for (double random_prob : random_probs) {
+                for (int i = 0; i < 200; i++) {
+                    const std::vector<T> values = generateValues<T>(rng,
+                        num_values, delta_bits, 0.25, random_prob);
+                    ASSERT_EQ(
+                        fitsBaseDeltaOf(*impl, values, delta_bits),
+                        fitsBaseDeltaOf(scalarImplementation, values,
+                                        delta_bits))
+                        << impl->name << ": " << num_values << " values of "
+                        << sizeof(T) << " bytes, " << delta_bits
+                        << "-bit deltas";
+                }
+            }
+        }
+    }
+}
+
+} // anonymous namespace
+
+/** The scalar kernels give the expected results on known blocks. */
+TEST(CompressorKernelsTest, ScalarReference)
+{
+    const uint64_t zeros[8] = {};
+    const uint64_t repeated[8] = {5, 5, 5, 5, 5, 5, 5, 5};
+    const uint64_t last_differs[8] = {5, 5, 5, 5, 5, 5, 5, 6};
+    ASSERT_TRUE(scalarImplementation.isZero(zeros, 8));
+    ASSERT_FALSE(scalarImplementation.isZero(repeated, 8));
+    ASSERT_TRUE(scalarImplementation.isRepeated(zeros, 8));
+    ASSERT_TRUE(scalarImplementation.isRepeated(repeated, 8));
+    ASSERT_FALSE(scalarImplementation.isRepeated(last_differs, 8));
+
+    // Immediates and values close to the first non-immediate value fit,
+    // whichever order they come in
+    const uint64_t bdi[4] = {1, 0x1000, 0x1000 - 127, 0x1000 + 127};
+    ASSERT_TRUE(scalarImplementation.fitsBaseDelta64(bdi, 4, 8));
+    const uint64_t bdi_far[4] = {1, 0x1000, 0x1000 - 128, 0x1000 + 127};
+    ASSERT_FALSE(scalarImplementation.fitsBaseDelta64(bdi_far, 4, 8));
+    const uint16_t bdi_wrap[4] = {0xFFFF, 0x8000, 0x7FFF, 0x8001};
+    ASSERT_TRUE(scalarImplementation.fitsBaseDelta16(bdi_wrap, 4, 2));
+}
+
+/** The vector zero and repetition checks match the scalar ones. */
+TEST(CompressorKernelsTest, ZeroAndRepeated)
+{
+    for (const Implementation* impl : hostImplementations()) {
+        for (std::size_t num_qwords = 1; num_qwords <= 32; num_qwords++) {
+            std::vector<uint64_t> data(num_qwords, 0);
+            ASSERT_TRUE(impl->isZero(data.data(), num_qwords));
+            ASSERT_TRUE(impl->isRepeated(data.data(), num_qwords));
+
+            // A single differing qword must be found wherever it is
+            for (std::size_t i = 0; i < num_qwords; i++) {
+                std::vector<uint64_t> changed(data);
+                changed[i] = uint64_t(1) << (i % 64);
+                ASSERT_EQ(impl->isZero(changed.data(), num_qwords),
+                          scalarImplementation.isZero(changed.data(),
+                                                      num_qwords))
+                    << impl->name << ": " << num_qwords << " qwords";
+                ASSERT_EQ(impl->isRepeated(changed.data(), num_qwords),
+                          scalarImplementation.isRepeated(changed.data(),
+                                                          num_qwords))
+                    << impl->name << ": " << num_qwords << " qwords";
+            }
+        }
+    }
+}
+
+/** The vector BDI checks match the scalar ones for all value sizes. */
+TEST(CompressorKernelsTest, FitsBaseDelta64)
+{
+    for (unsigned delta_bits : {0, 1, 8, 16, 32}) {
+        checkFitsBaseDelta<uint64_t>(delta_bits);
+    }
+}
+
+TEST(CompressorKernelsTest, FitsBaseDelta32)
+{
+    for (unsigned delta_bits : {0, 1, 8, 16}) {
+        checkFitsBaseDelta<uint32_t>(delta_bits);
+    }
+}
+
+TEST(CompressorKernelsTest, FitsBaseDelta16)
+{
+    for (unsigned delta_bits : {0, 1, 8}) {
+        checkFitsBaseDelta<uint16_t>(delta_bits);
+    }
+}
@@ -0,0 +1,110 @@
+/*
+ * Copyright (c) 2026 The gem5 Authors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** @file
+ * AVX2 implementation of the compressor kernels. This file must be compiled
+ * with AVX2 code generation enabled; it is only used if the host supports it.
+ */
+
+#if defined(__AVX2__)
+
+#include <immintrin.h>
+
+#include "mem/cache/compressors/kernels_impl.hh"
+
+namespace Compressor {
+namespace Kernels {
+
+namespace {
+
+/** 256-bit vector operations. */
+struct AVX2
+{
+    typedef __m256i Vec;
+    static constexpr std::size_t Bytes = sizeof(Vec);
+
+    static Vec zero() { return _mm256_setzero_si256(); }
+    static Vec
+    load(const void* ptr)
+    {
+        return _mm256_loadu_si256(static_cast<const Vec*>(ptr));
+    }
+
+    static Vec set1(uint64_t value) { return _mm256_set1_epi64x(value); }
+    static Vec set1(uint32_t value) { return _mm256_set1_epi32(value); }
+    static Vec set1(uint16_t value) { return _mm256_set1_epi16(value); }
+
+    static Vec bitOr(Vec a, Vec b) { return _mm256_or_si256(a, b); }
+    static Vec bitAnd(Vec a, Vec b) { return _mm256_and_si256(a, b); }
+    static Vec bitXor(Vec a, Vec b) { return _mm256_xor_si256(a, b); }
+
+    static Vec add(Vec a, Vec b, uint64_t) { return _mm256_add_epi64(a, b); }
+    static Vec add(Vec a, Vec b, uint32_t) { return _mm256_add_epi32(a, b); }
+    static Vec add(Vec a, Vec b, uint16_t) { return _mm256_add_epi16(a, b); }
+    static Vec sub(Vec a, Vec b, uint64_t) { return _mm256_sub_epi64(a, b); }
+    static Vec sub(Vec a, Vec b, uint32_t) { return _mm256_sub_epi32(a, b); }
+    static Vec sub(Vec a, Vec b, uint16_t) { return _mm256_sub_epi16(a, b); }
+
+    static Vec
+    greaterThan(Vec a, Vec b, uint64_t)
+    {
+        return _mm256_cmpgt_epi64(a, b);
+    }
+    static Vec
+    greaterThan(Vec a, Vec b, uint32_t)
+    {
+        return _mm256_cmpgt_epi32(a, b);
+    }
+    static Vec
+    greaterThan(Vec a, Vec b, uint16_t)
+    {
+        return _mm256_cmpgt_epi16(a, b);
+    }
+
+    static uint64_t
+    byteMask(Vec a)
+    {
+        return static_cast<uint32_t>(_mm256_movemask_epi8(a));
+    }
+    static bool isAllZero(Vec a) { return _mm256_testz_si256(a, a); }
+    static bool
+    isEqual(Vec a, Vec b)
+    {
+        return byteMask(_mm256_cmpeq_epi8(a, b)) == 0xFFFFFFFF;
+    }
+};
+
+} // anonymous namespace
+
+const Implementation avx2Implementation =
+    makeImplementation<AVX2>("avx2");
+
+} // namespace Kernels
+} // namespace Compressor
+
+#endif // __AVX2__
@@ -0,0 +1,245 @@
+/*
+ * Copyright (c) 2026 The gem5 Authors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** @file
+ * Generic implementation of the compressor kernels. The vectorized versions
+ * are written once against a small set of vector operations (V), and are
+ * instantiated by ISA-specific translation units compiled with the proper
+ * code generation flags.
+ *
+ * Every function defined in this header has internal linkage, and it must
+ * not call functions with external linkage defined in other headers (e.g.,
+ * the ones of base/bitfield.hh). Otherwise the copy emitted by a vector
+ * translation unit could be picked by the linker for all of them, and
+ * executed on hosts that do not support its instructions.
+ */
+
+#ifndef __MEM_CACHE_COMPRESSORS_KERNELS_IMPL_HH__
+#define __MEM_CACHE_COMPRESSORS_KERNELS_IMPL_HH__
+
+#include <cstddef>
+#include <cstdint>
+
+#include "mem/cache/compressors/kernels.hh"
+
+namespace Compressor {
+namespace Kernels {
+
+/** Table of the kernels provided by an implementation. */
+struct Implementation
+{
+    const char* name;
+    bool (*isZero)(const uint64_t*, std::size_t);
+    bool (*isRepeated)(const uint64_t*, std::size_t);
+    bool (*fitsBaseDelta64)(const uint64_t*, std::size_t, unsigned);
+    bool (*fitsBaseDelta32)(const uint32_t*, std::size_t, unsigned);
+    bool (*fitsBaseDelta16)(const uint16_t*, std::size_t, unsigned);
+};
+
+/** Portable implementation, used if no other one is supported. */
+extern const Implementation scalarImplementation;
+
+/** Implementations available on x86 hosts. */
+extern const Implementation sse42Implementation;
+extern const Implementation avx2Implementation;
+
+namespace {
+
+/**
+ * Get the largest magnitude of a signed delta of the given size.
+ *
+ * @param delta_bits Size of a delta, in bits.
+ * @return The limit of the delta.
+ */
+template <class T>
+inline T
+deltaLimit(unsigned delta_bits)
+{
+    return delta_bits ? static_cast<T>((uint64_t(1) << (delta_bits - 1)) - 1)
+                      : T(0);
+}
+
+/**
+ * Check if a value is within a signed delta of a base. The delta fits in
+ * [-limit, limit] if and only if (value - base + limit) fits in
+ * [0, 2 * limit] when interpreted as an unsigned value.
+ */
+template <class T>
+inline bool
+isNear(T value, T base, T limit)
+{
+    return static_cast<T>(value - base + limit) <= static_cast<T>(2 * limit);
+}
+
+template <class T>
+bool
+fitsBaseDeltaScalar(const T* values, std::size_t num_values,
+    unsigned delta_bits)
+{
+    const T limit = deltaLimit<T>(delta_bits);
+
+    // Skip all immediates (i.e., values close to the implicit zero base)
+    std::size_t i = 0;
+    while ((i < num_values) && isNear<T>(values[i], 0, limit)) {
+        i++;
+    }
+    if (i == num_values) {
+        return true;
+    }
+
+    // The first non-immediate value becomes the base. Every value from
+    // then on must be close to either base
+    const T base = values[i];
+    for (; i < num_values; i++) {
+        if (!isNear<T>(values[i], 0, limit) &&
+            !isNear<T>(values[i], base, limit)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+template <class V>
+bool
+isZeroVec(const uint64_t* data, std::size_t num_qwords)
+{
+    constexpr std::size_t qwords_per_vec = V::Bytes / sizeof(uint64_t);
+
+    typename V::Vec acc = V::zero();
+    std::size_t i = 0;
+    for (; i + qwords_per_vec <= num_qwords; i += qwords_per_vec) {
+        acc = V::bitOr(acc, V::load(data + i));
+    }
+    bool is_zero = V::isAllZero(acc);
+    for (; i < num_qwords; i++) {
+        is_zero &= (data[i] == 0);
+    }
+    return is_zero;
+}
+
+template <class V>
+bool
+isRepeatedVec(const uint64_t* data, std::size_t num_qwords)
+{
+    constexpr std::size_t qwords_per_vec = V::Bytes / sizeof(uint64_t);
+
+    if (num_qwords == 0) {
+        return true;
+    }
+
+    const typename V::Vec first = V::set1(data[0]);
+    std::size_t i = 0;
+    for (; i + qwords_per_vec <= num_qwords; i += qwords_per_vec) {
+        if (!V::isEqual(first, V::load(data + i))) {
+            return false;
+        }
+    }
+    for (; i < num_qwords; i++) {
+        if (data[i] != data[0]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+template <class V, class T>
+bool
+fitsBaseDeltaVec(const T* values, std::size_t num_values, unsigned delta_bits)
+{
+    using Vec = typename V::Vec;
+    constexpr std::size_t values_per_vec = V::Bytes / sizeof(T);
+
+    // Blocks are powers of two, so this only happens for tiny blocks
+    if (num_values % values_per_vec) {
+        return fitsBaseDeltaScalar<T>(values, num_values, delta_bits);
+    }
+
+    // The unsigned range check of isNear() is done with a signed compare
+    // by flipping the sign bits of both operands
+    const T limit = deltaLimit<T>(delta_bits);
+    const T sign_bit = static_cast<T>(T(1) << (sizeof(T) * 8 - 1));
+    const Vec limit_vec = V::set1(limit);
+    const Vec sign_vec = V::set1(sign_bit);
+    const Vec range_vec = V::set1(static_cast<T>((2 * limit) ^ sign_bit));
+    const Vec zero_vec = V::zero();
+    auto far = [&](const Vec& value, const Vec& base) {
+        const Vec biased = V::add(V::sub(value, base, T()), limit_vec, T());
+        return V::greaterThan(V::bitXor(biased, sign_vec), range_vec, T());
+    };
+
+    // Search for the first value that is not an immediate
+    std::size_t i = 0;
+    uint64_t far_mask = 0;
+    for (; i < num_values; i += values_per_vec) {
+        far_mask = V::byteMask(far(V::load(values + i), zero_vec));
+        if (far_mask) {
+            break;
+        }
+    }
+    if (i == num_values) {
+        return true;
+    }
+
+    // Check the remaining values against both bases. The values preceding
+    // the base in its vector are immediates, so they pass the check again
+    const std::size_t base_index = i + __builtin_ctzll(far_mask) / sizeof(T);
+    const Vec base_vec = V::set1(values[base_index]);
+    for (; i < num_values; i += values_per_vec) {
+        const Vec value = V::load(values + i);
+        if (V::byteMask(V::bitAnd(far(value, zero_vec),
+                                  far(value, base_vec)))) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * Instantiate the kernel table of an implementation based on the vector
+ * operations V.
+ */
+template <class V>
+constexpr Implementation
+makeImplementation(const char* name)
+{
+    return Implementation{
+        name,
+        &isZeroVec<V>,
+        &isRepeatedVec<V>,
+        &fitsBaseDeltaVec<V, uint64_t>,
+        &fitsBaseDeltaVec<V, uint32_t>,
+        &fitsBaseDeltaVec<V, uint16_t>,
+    };
+}
+
+} // anonymous namespace
+
+} // namespace Kernels
+} // namespace Compressor
+
+#endif //__MEM_CACHE_COMPRESSORS_KERNELS_IMPL_HH__
@@ -174,7 +174,7 @@ Multi::decompress(const CompressionData* comp_data,
 {
     const MultiCompData* casted_comp_data =
         static_cast<const MultiCompData*>(comp_data);
-    compressors[casted_comp_data->getIndex()]->decompress(
+    compressors[casted_comp_data->getIndex()]->decompressData(
         casted_comp_data->compData.get(), cache_line);
 }
 
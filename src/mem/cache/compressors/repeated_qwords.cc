@@ -36,6 +36,7 @@
 #include "base/trace.hh"
 #include "debug/CacheComp.hh"
 #include "mem/cache/compressors/dictionary_compressor_impl.hh"
+#include "mem/cache/compressors/kernels.hh"
 #include "params/RepeatedQwordsCompressor.hh"
 
 namespace Compressor {
@@ -56,15 +57,16 @@ std::unique_ptr<Base::CompressionData>
 RepeatedQwords::compress(const std::vector<Chunk>& chunks,
     Cycles& comp_lat, Cycles& decomp_lat)
 {
-    std::unique_ptr<Base::CompressionData> comp_data =
-        DictionaryCompressor::compress(chunks);
+    std::unique_ptr<Base::CompressionData> comp_data;
 
     // Since there is a single value repeated over and over, there should be
     // a single dictionary entry. If there are more, the compressor failed
-    assert(numEntries >= 1);
-    if (numEntries > 1) {
-        comp_data->setSizeBits(blkSize * 8);
+    if (!Kernels::isRepeated(chunks.data(), chunks.size())) {
+        comp_data = compressIncompressible<PatternX>(chunks);
         DPRINTF(CacheComp, "Repeated qwords compression failed\n");
+    } else {
+        comp_data = DictionaryCompressor::compress(chunks);
+        assert(numEntries == 1);
     }
 
     // Set compression latency
@@ -36,6 +36,7 @@
 #include "base/trace.hh"
 #include "debug/CacheComp.hh"
 #include "mem/cache/compressors/dictionary_compressor_impl.hh"
+#include "mem/cache/compressors/kernels.hh"
 #include "params/ZeroCompressor.hh"
 
 namespace Compressor {
@@ -56,13 +57,15 @@ std::unique_ptr<Base::CompressionData>
 Zero::compress(const std::vector<Chunk>& chunks, Cycles& comp_lat,
     Cycles& decomp_lat)
 {
-    std::unique_ptr<Base::CompressionData> comp_data =
-        DictionaryCompressor::compress(chunks);
+    std::unique_ptr<Base::CompressionData> comp_data;
 
     // If there is any non-zero entry, the compressor failed
-    if (numEntries > 0) {
-        comp_data->setSizeBits(blkSize * 8);
+    if (!Kernels::isZero(chunks.data(), chunks.size())) {
+        comp_data = compressIncompressible<PatternX>(chunks);
         DPRINTF(CacheComp, "Zero compression failed\n");
+    } else {
+        comp_data = DictionaryCompressor::compress(chunks);
+        assert(numEntries == 0);
     }
 
     // Set compression latency (Assumes full line zero comparison)
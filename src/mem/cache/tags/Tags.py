@@ -63,6 +63,10 @@ class BaseTags(ClockedObject):
     sequential_access = Param.Bool(Parent.sequential_access,
         "Whether to access tags and data sequentially")
 
+    # Get the data-less mode from the parent (cache)
+    data_less = Param.Bool(Parent.data_less,
+        "Whether to allocate no data storage for the blocks")
+
     # Get indexing policy
     indexing_policy = Param.BaseIndexingPolicy(SetAssociative(),
         "Indexing policy")
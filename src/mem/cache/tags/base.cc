@@ -61,7 +61,9 @@ BaseTags::BaseTags(const Params *p)
       system(p->system), indexingPolicy(p->indexing_policy),
       warmupBound((p->warmup_percentage/100.0) * (p->size / p->block_size)),
       warmedUp(false), numBlocks(p->size / p->block_size),
-      dataBlks(new uint8_t[p->size]), // Allocate data storage in one big chunk
+      dataLess(p->data_less),
+      // Allocate data storage in one big chunk
+      dataBlks(dataLess ? nullptr : new uint8_t[p->size]),
       stats(*this)
 {
     registerExitCallback([this]() { cleanupRefs(); });
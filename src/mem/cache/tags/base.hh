@@ -96,9 +96,27 @@ class BaseTags : public ClockedObject
     /** the number of blocks in the cache */
     const unsigned numBlocks;
 
-    /** The data blocks, 1 per cache block. */
+    /**
+     * Whether blocks keep their own data. Data-less tags allocate no
+     * storage and leave it to the cache to point blocks at memory.
+     */
+    const bool dataLess;
+
+    /** The data blocks, 1 per cache block. Null when data-less. */
     std::unique_ptr<uint8_t[]> dataBlks;
 
+    /**
+     * Get the data storage of a block.
+     *
+     * @param blk_index Index of the block in the data array.
+     * @return Pointer to the block's data, or nullptr when data-less.
+     */
+    uint8_t *
+    blockData(unsigned blk_index) const
+    {
+        return dataLess ? nullptr : &dataBlks[blkSize * blk_index];
+    }
+
     /**
      * TODO: It would be good if these stats were acquired after warmup.
      */
@@ -170,6 +188,12 @@ class BaseTags : public ClockedObject
      */
     virtual void tagsInit() = 0;
 
+    /** Whether blocks are allocated without data storage. */
+    bool isDataLess() const { return dataLess; }
+
+    /** Whether no block is currently valid. */
+    bool isEmpty() const { return stats.tagsInUse.value() == 0; }
+
     /**
      * Average in the reference count for valid blocks when the simulation
      * exits.
@@ -89,7 +89,7 @@ SectorTags::tagsInit()
             blk = &blks[blk_index];
 
             // Associate a data chunk to the block
-            blk->data = &dataBlks[blkSize*blk_index];
+            blk->data = blockData(blk_index);
 
             // Associate sector block to this block
             blk->setSectorBlock(sec_blk);
@@ -52,7 +52,8 @@
 #include "sim/system.hh"
 
 CoherentXBar::CoherentXBar(const CoherentXBarParams *p)
-    : BaseXBar(p), system(p->system), snoopFilter(p->snoop_filter),
+    : BaseXBar(p), outstandingSnoop(p->max_outstanding_snoops),
+      system(p->system), snoopFilter(p->snoop_filter),
       snoopResponseLatency(p->snoop_response_latency),
       maxOutstandingSnoopCheck(p->max_outstanding_snoops),
       maxRoutingTableSizeCheck(p->max_routing_table_size),
@@ -61,7 +62,9 @@ CoherentXBar::CoherentXBar(const CoherentXBarParams *p)
 
       snoops(this, "snoops", "Total snoops (count)"),
       snoopTraffic(this, "snoopTraffic", "Total snoop traffic (bytes)"),
-      snoopFanout(this, "snoop_fanout", "Request fanout histogram")
+      snoopFanout(this, "snoop_fanout", "Request fanout histogram"),
+      outstandingSnoopOccupancy(this, "outstanding_snoop_occupancy",
+              "Average number of outstanding snoop requests")
 {
     // create the ports based on the size of the memory-side port and
     // CPU-side port vector ports, and the presence of the default port,
@@ -323,9 +326,10 @@ CoherentXBar::recvTimingReq(PacketPtr pkt, PortID cpu_side_port_id)
             // response
             if (expect_snoop_resp) {
                 // we should never have an exsiting request outstanding
-                assert(outstandingSnoop.find(pkt->req) ==
-                       outstandingSnoop.end());
-                outstandingSnoop.insert(pkt->req);
+                const bool M5_VAR_USED inserted =
+                    outstandingSnoop.insert(pkt->req);
+                assert(inserted);
+                outstandingSnoopOccupancy = outstandingSnoop.size();
 
                 // basic sanity check on the outstanding snoops
                 panic_if(outstandingSnoop.size() > maxOutstandingSnoopCheck,
@@ -335,8 +339,7 @@ CoherentXBar::recvTimingReq(PacketPtr pkt, PortID cpu_side_port_id)
 
             // remember where to route the normal response to
             if (expect_response || expect_snoop_resp) {
-                assert(routeTo.find(pkt->req) == routeTo.end());
-                routeTo[pkt->req] = cpu_side_port_id;
+                addRoute(pkt->req, cpu_side_port_id);
 
                 panic_if(routeTo.size() > maxRoutingTableSizeCheck,
                          "%s: Routing table exceeds %d packets\n",
@@ -396,15 +399,14 @@ CoherentXBar::recvTimingReq(PacketPtr pkt, PortID cpu_side_port_id)
                 assert(rsp_port_id != InvalidPortID);
                 assert(rsp_port_id < respLayers.size());
                 // remove the request from the routing table
-                routeTo.erase(route_lookup);
+                removeRoute(rsp_pkt->req);
             }
             outstandingCMO.erase(cmo_lookup);
         } else {
             respond_directly = false;
             outstandingCMO.emplace(pkt->id, deferred_rsp);
             if (!pkt->isWrite()) {
-                assert(routeTo.find(pkt->req) == routeTo.end());
-                routeTo[pkt->req] = cpu_side_port_id;
+                addRoute(pkt->req, cpu_side_port_id);
 
                 panic_if(routeTo.size() > maxRoutingTableSizeCheck,
                          "%s: Routing table exceeds %d packets\n",
@@ -489,7 +491,7 @@ CoherentXBar::recvTimingResp(PacketPtr pkt, PortID mem_side_port_id)
                                         + latency);
 
     // remove the request from the routing table
-    routeTo.erase(route_lookup);
+    removeRoute(pkt->req);
 
     respLayers[cpu_side_port_id]->succeededTiming(packetFinishTime);
 
@@ -549,8 +551,7 @@ CoherentXBar::recvTimingSnoopReq(PacketPtr pkt, PortID mem_side_port_id)
 
     // if we can expect a response, remember how to route it
     if (!cache_responding && pkt->cacheResponding()) {
-        assert(routeTo.find(pkt->req) == routeTo.end());
-        routeTo[pkt->req] = mem_side_port_id;
+        addRoute(pkt->req, mem_side_port_id);
     }
 
     // a snoop request came from a connected CPU-side-port device (one of
@@ -577,8 +578,7 @@ CoherentXBar::recvTimingSnoopResp(PacketPtr pkt, PortID cpu_side_port_id)
     // created as the result of a normal request (in which case it
     // should be in the outstandingSnoop), or if we merely forwarded
     // someone else's snoop request
-    const bool forwardAsSnoop = outstandingSnoop.find(pkt->req) ==
-        outstandingSnoop.end();
+    const bool forwardAsSnoop = !outstandingSnoop.count(pkt->req);
 
     // test if the crossbar should be considered occupied for the
     // current port, note that the check is bypassed if the response
@@ -651,6 +651,7 @@ CoherentXBar::recvTimingSnoopResp(PacketPtr pkt, PortID cpu_side_port_id)
         // since we created the snoop request as part of recvTiming,
         // this should now be a normal response again
         outstandingSnoop.erase(pkt->req);
+        outstandingSnoopOccupancy = outstandingSnoop.size();
 
         // this is a snoop response from a coherent requestor, hence it
         // should never go back to where the snoop response came from,
@@ -680,7 +681,7 @@ CoherentXBar::recvTimingSnoopResp(PacketPtr pkt, PortID cpu_side_port_id)
     }
 
     // remove the request from the routing table
-    routeTo.erase(route_lookup);
+    removeRoute(pkt->req);
 
     // stats updates
     transDist[pkt_cmd]++;
@@ -1116,6 +1117,10 @@ CoherentXBar::regStats()
     BaseXBar::regStats();
 
     snoopFanout.init(0, snoopPorts.size(), 1);
+
+    outstandingSnoopOccupancy
+        .precision(2)
+        .flags(Stats::nozero);
 }
 
 CoherentXBar *
@@ -46,9 +46,7 @@
 #ifndef __MEM_COHERENT_XBAR_HH__
 #define __MEM_COHERENT_XBAR_HH__
 
-#include <unordered_map>
-#include <unordered_set>
-
+#include "base/open_hash_map.hh"
 #include "mem/snoop_filter.hh"
 #include "mem/xbar.hh"
 #include "params/CoherentXBar.hh"
@@ -255,14 +253,14 @@ class CoherentXBar : public BaseXBar
      * responses from so we can determine which snoop responses we
      * generated and which ones were merely forwarded.
      */
-    std::unordered_set<RequestPtr> outstandingSnoop;
+    OpenHashSet<RequestPtr> outstandingSnoop;
 
     /**
      * Store the outstanding cache maintenance that we are expecting
      * snoop responses from so we can determine when we received all
      * snoop responses and if any of the agents satisfied the request.
      */
-    std::unordered_map<PacketId, PacketPtr> outstandingCMO;
+    OpenHashMap<PacketId, PacketPtr> outstandingCMO;
 
     /**
      * Keep a pointer to the system to be allow to querying memory system
@@ -418,6 +416,7 @@ class CoherentXBar : public BaseXBar
     Stats::Scalar snoops;
     Stats::Scalar snoopTraffic;
     Stats::Distribution snoopFanout;
+    Stats::Average outstandingSnoopOccupancy;
 
   public:
 
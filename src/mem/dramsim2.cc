@@ -170,6 +170,16 @@ DRAMSim2::recvFunctional(PacketPtr pkt)
     pkt->popLabel();
 }
 
+bool
+DRAMSim2::findHeldLines(Addr addr, Addr size, std::vector<Addr> &lines) const
+{
+    for (const auto pkt : responseQueue) {
+        if (carriesData(pkt, addr, size))
+            return false;
+    }
+    return true;
+}
+
 bool
 DRAMSim2::recvTimingReq(PacketPtr pkt)
 {
@@ -47,10 +47,11 @@
 
 #include "mem/abstract_mem.hh"
 #include "mem/dramsim2_wrapper.hh"
+#include "mem/functional_data_holder.hh"
 #include "mem/qport.hh"
 #include "params/DRAMSim2.hh"
 
-class DRAMSim2 : public AbstractMemory
+class DRAMSim2 : public AbstractMemory, public FunctionalDataHolder
 {
   private:
 
@@ -195,6 +196,13 @@ class DRAMSim2 : public AbstractMemory
     void init() override;
     void startup() override;
 
+    /**
+     * Report that the memory cannot tell which lines are held if a
+     * queued response carries data of the range.
+     */
+    bool findHeldLines(Addr addr, Addr size,
+                       std::vector<Addr> &lines) const override;
+
   protected:
 
     Tick recvAtomic(PacketPtr pkt);
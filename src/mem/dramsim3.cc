@@ -174,6 +174,16 @@ DRAMsim3::recvFunctional(PacketPtr pkt)
     pkt->popLabel();
 }
 
+bool
+DRAMsim3::findHeldLines(Addr addr, Addr size, std::vector<Addr> &lines) const
+{
+    for (const auto pkt : responseQueue) {
+        if (carriesData(pkt, addr, size))
+            return false;
+    }
+    return true;
+}
+
 bool
 DRAMsim3::recvTimingReq(PacketPtr pkt)
 {
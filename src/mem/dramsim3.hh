@@ -49,10 +49,11 @@
 
 #include "mem/abstract_mem.hh"
 #include "mem/dramsim3_wrapper.hh"
+#include "mem/functional_data_holder.hh"
 #include "mem/qport.hh"
 #include "params/DRAMsim3.hh"
 
-class DRAMsim3 : public AbstractMemory
+class DRAMsim3 : public AbstractMemory, public FunctionalDataHolder
 {
   private:
 
@@ -206,6 +207,13 @@ class DRAMsim3 : public AbstractMemory
 
     void resetStats() override;
 
+    /**
+     * Report that the memory cannot tell which lines are held if a
+     * queued response carries data of the range.
+     */
+    bool findHeldLines(Addr addr, Addr size,
+                       std::vector<Addr> &lines) const override;
+
   protected:
 
     Tick recvAtomic(PacketPtr pkt);
@@ -0,0 +1,62 @@
+/*
+ * Copyright (c) 2026 The gem5 Authors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "mem/functional_data_holder.hh"
+
+#include <algorithm>
+
+std::vector<FunctionalDataHolder *> &
+FunctionalDataHolder::holders()
+{
+    static std::vector<FunctionalDataHolder *> all_holders;
+    return all_holders;
+}
+
+FunctionalDataHolder::FunctionalDataHolder()
+{
+    holders().push_back(this);
+}
+
+FunctionalDataHolder::~FunctionalDataHolder()
+{
+    auto &all_holders = holders();
+    all_holders.erase(std::remove(all_holders.begin(), all_holders.end(),
+                                  this),
+                      all_holders.end());
+}
+
+bool
+FunctionalDataHolder::findAllHeldLines(Addr addr, Addr size,
+                                       std::vector<Addr> &lines)
+{
+    for (const auto holder : holders()) {
+        if (!holder->findHeldLines(addr, size, lines))
+            return false;
+    }
+    return true;
+}
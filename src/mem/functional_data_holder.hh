@@ -0,0 +1,94 @@
+/*
+ * Copyright (c) 2026 The gem5 Authors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __MEM_FUNCTIONAL_DATA_HOLDER_HH__
+#define __MEM_FUNCTIONAL_DATA_HOLDER_HH__
+
+#include <vector>
+
+#include "base/types.hh"
+#include "mem/packet.hh"
+
+/**
+ * Interface of the objects that may hold a more recent copy of memory
+ * data than the backing store, e.g. caches or the queues of packets in
+ * flight. Bulk functional accesses consult all of them before going
+ * straight to the backing store. Holders register themselves when they
+ * are constructed.
+ */
+class FunctionalDataHolder
+{
+  private:
+    /** Get the list of all existing holders. */
+    static std::vector<FunctionalDataHolder *> &holders();
+
+  protected:
+    FunctionalDataHolder();
+
+    /**
+     * Check if a packet carries data of an address range.
+     *
+     * @param pkt The packet to check.
+     * @param addr Start address of the range.
+     * @param size Size of the range in bytes.
+     */
+    static bool
+    carriesData(const Packet *pkt, Addr addr, Addr size)
+    {
+        return pkt->hasData() && pkt->getAddr() < addr + size &&
+            addr < pkt->getAddr() + pkt->getSize();
+    }
+
+  public:
+    virtual ~FunctionalDataHolder();
+
+    /**
+     * Collect the lines of an address range that this object holds,
+     * and which must therefore be accessed through the memory system.
+     *
+     * @param addr Start address of the range.
+     * @param size Size of the range in bytes.
+     * @param lines Line addresses to append the held lines to.
+     * @return False if the holder cannot tell (e.g. it has packets in
+     *         flight), in which case the whole range must be accessed
+     *         through the memory system.
+     */
+    virtual bool findHeldLines(Addr addr, Addr size,
+                               std::vector<Addr> &lines) const = 0;
+
+    /**
+     * Collect the lines of an address range held by any holder.
+     *
+     * @return False if any holder cannot tell.
+     * @sa findHeldLines()
+     */
+    static bool findAllHeldLines(Addr addr, Addr size,
+                                 std::vector<Addr> &lines);
+};
+
+#endif // __MEM_FUNCTIONAL_DATA_HOLDER_HH__
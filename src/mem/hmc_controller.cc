@@ -104,8 +104,7 @@ bool HMCController::recvTimingReq(PacketPtr pkt, PortID cpu_side_port_id)
 
     // remember where to route the response to
     if (expect_response) {
-        assert(routeTo.find(pkt->req) == routeTo.end());
-        routeTo[pkt->req] = cpu_side_port_id;
+        addRoute(pkt->req, cpu_side_port_id);
     }
 
     reqLayers[mem_side_port_id]->succeededTiming(packetFinishTime);
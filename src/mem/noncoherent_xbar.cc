@@ -159,8 +159,7 @@ NoncoherentXBar::recvTimingReq(PacketPtr pkt, PortID cpu_side_port_id)
 
     // remember where to route the response to
     if (expect_response) {
-        assert(routeTo.find(pkt->req) == routeTo.end());
-        routeTo[pkt->req] = cpu_side_port_id;
+        addRoute(pkt->req, cpu_side_port_id);
     }
 
     reqLayers[mem_side_port_id]->succeededTiming(packetFinishTime);
@@ -219,7 +218,7 @@ NoncoherentXBar::recvTimingResp(PacketPtr pkt, PortID mem_side_port_id)
                                         curTick() + latency);
 
     // remove the request from the routing table
-    routeTo.erase(route_lookup);
+    removeRoute(pkt->req);
 
     respLayers[cpu_side_port_id]->succeededTiming(packetFinishTime);
 
@@ -100,6 +100,17 @@ PacketQueue::trySatisfyFunctional(PacketPtr pkt)
     return found;
 }
 
+bool
+PacketQueue::findHeldLines(Addr addr, Addr size,
+                           std::vector<Addr> &lines) const
+{
+    for (const auto &p : transmitList) {
+        if (carriesData(p.pkt, addr, size))
+            return false;
+    }
+    return true;
+}
+
 void
 PacketQueue::schedSendTiming(PacketPtr pkt, Tick when)
 {
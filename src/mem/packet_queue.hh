@@ -50,7 +50,9 @@
  */
 
 #include <list>
+#include <vector>
 
+#include "mem/functional_data_holder.hh"
 #include "mem/port.hh"
 #include "sim/drain.hh"
 #include "sim/eventq.hh"
@@ -59,7 +61,7 @@
  * A packet queue is a class that holds deferred packets and later
  * sends them using the associated CPU-side port or memory-side port.
  */
-class PacketQueue : public Drainable
+class PacketQueue : public Drainable, public FunctionalDataHolder
 {
   private:
     /** A deferred packet, buffered to transmit later. */
@@ -182,6 +184,14 @@ class PacketQueue : public Drainable
      * functional request. */
     bool trySatisfyFunctional(PacketPtr pkt);
 
+    /**
+     * A buffered packet may carry more recent data than the backing
+     * store for any part of a line, hence report that the queue cannot
+     * tell if any packet carries data of the range.
+     */
+    bool findHeldLines(Addr addr, Addr size,
+                       std::vector<Addr> &lines) const override;
+
     /**
      * Schedule a send event if we are not already waiting for a
      * retry. If the requested time is before an already scheduled
@@ -39,14 +39,22 @@
 
 #include <fcntl.h>
 #include <sys/mman.h>
+#include <sys/stat.h>
 #include <sys/types.h>
 #include <sys/user.h>
 #include <unistd.h>
 #include <zlib.h>
 
+#if defined(__linux__)
+#include <linux/mempolicy.h>
+#include <sys/syscall.h>
+#endif
+
+#include <algorithm>
 #include <cerrno>
 #include <climits>
 #include <cstdio>
+#include <cstring>
 #include <iostream>
 #include <string>
 
@@ -72,13 +80,22 @@ using namespace std;
 PhysicalMemory::PhysicalMemory(const string& _name,
                                const vector<AbstractMemory*>& _memories,
                                bool mmap_using_noreserve,
-                               const std::string& shared_backstore) :
+                               const std::string& shared_backstore,
+                               bool compress_stores, bool lazy_restore,
+                               BackingStoreHugePages huge_pages,
+                               BackingStoreNumaPolicy numa_policy,
+                               const vector<unsigned> &numa_nodes) :
     _name(_name), size(0), mmapUsingNoReserve(mmap_using_noreserve),
-    sharedBackstore(shared_backstore)
+    sharedBackstore(shared_backstore), compressStores(compress_stores),
+    lazyRestore(lazy_restore), hugePages(huge_pages),
+    numaPolicy(numa_policy), numaNodes(numa_nodes)
 {
     if (mmap_using_noreserve)
         warn("Not reserving swap space. May cause SIGSEGV on actual usage\n");
 
+    fatal_if(numaPolicy != BackingStoreNumaPolicy::none && numaNodes.empty(),
+             "A NUMA policy for the backing store needs NUMA nodes\n");
+
     // add the memories from the system to the address map as
     // appropriate
     for (const auto& m : _memories) {
@@ -218,9 +235,31 @@ PhysicalMemory::createBackingStore(AddrRange range,
         map_flags |= MAP_NORESERVE;
     }
 
-    uint8_t* pmem = (uint8_t*) mmap(NULL, range.size(),
-                                    PROT_READ | PROT_WRITE,
-                                    map_flags, shm_fd, 0);
+    uint8_t* pmem = (uint8_t*) MAP_FAILED;
+    bool huge_tlb = false;
+
+    // hugetlb pages have to be reserved on the host, so fall back to
+    // normal pages if there aren't enough of them
+    if (hugePages == BackingStoreHugePages::hugetlb) {
+#if defined(MAP_HUGETLB)
+        if (shm_fd == -1) {
+            pmem = (uint8_t*) mmap(NULL, range.size(),
+                                   PROT_READ | PROT_WRITE,
+                                   map_flags | MAP_HUGETLB, shm_fd, 0);
+            huge_tlb = pmem != (uint8_t*) MAP_FAILED;
+        }
+#endif
+        if (!huge_tlb) {
+            warn("Could not map range %s with hugetlb pages, using "
+                 "normal pages\n", range.to_string());
+        }
+    }
+
+    if (!huge_tlb) {
+        pmem = (uint8_t*) mmap(NULL, range.size(),
+                               PROT_READ | PROT_WRITE,
+                               map_flags, shm_fd, 0);
+    }
 
     if (pmem == (uint8_t*) MAP_FAILED) {
         perror("mmap");
@@ -228,6 +267,11 @@ PhysicalMemory::createBackingStore(AddrRange range,
               range.to_string());
     }
 
+    string policy = applyHostPolicy(pmem, range, backingStore.size(),
+                                    huge_tlb);
+    if (!policy.empty())
+        inform("Backing store for range %s: %s\n", range.to_string(), policy);
+
     // remember this backing store so we can checkpoint it and unmap
     // it appropriately
     backingStore.emplace_back(range, pmem,
@@ -241,6 +285,80 @@ PhysicalMemory::createBackingStore(AddrRange range,
     }
 }
 
+string
+PhysicalMemory::applyHostPolicy(uint8_t *pmem, const AddrRange &range,
+                                unsigned store_id, bool huge_tlb) const
+{
+    string applied;
+    auto add = [&applied](const string &desc) {
+        applied += (applied.empty() ? "" : ", ") + desc;
+    };
+
+    if (huge_tlb) {
+        add("hugetlb pages");
+    } else if (hugePages == BackingStoreHugePages::transparent) {
+#if defined(MADV_HUGEPAGE)
+        if (madvise(pmem, range.size(), MADV_HUGEPAGE) == 0)
+            add("transparent huge pages");
+        else
+            warn("Could not enable transparent huge pages for range %s\n",
+                 range.to_string());
+#else
+        warn("Transparent huge pages are not supported on this host\n");
+#endif
+    }
+
+    if (numaPolicy == BackingStoreNumaPolicy::none)
+        return applied;
+
+#if defined(__linux__) && defined(SYS_mbind)
+    // bind and preferred place each store on one of the nodes, in
+    // turn, while interleave spreads every store over all of them
+    vector<unsigned> nodes;
+    int mode;
+    switch (numaPolicy) {
+      case BackingStoreNumaPolicy::interleave:
+        mode = MPOL_INTERLEAVE;
+        nodes = numaNodes;
+        break;
+      case BackingStoreNumaPolicy::bind:
+        mode = MPOL_BIND;
+        nodes.push_back(numaNodes[store_id % numaNodes.size()]);
+        break;
+      case BackingStoreNumaPolicy::preferred:
+        mode = MPOL_PREFERRED;
+        nodes.push_back(numaNodes[store_id % numaNodes.size()]);
+        break;
+      default:
+        panic("Unknown NUMA policy\n");
+    }
+
+    const unsigned bits = sizeof(unsigned long) * 8;
+    unsigned max_node = *max_element(nodes.begin(), nodes.end());
+    vector<unsigned long> mask(max_node / bits + 1, 0);
+    for (auto node : nodes)
+        mask[node / bits] |= 1UL << (node % bits);
+
+    // the kernel only looks at the first maxnode - 1 bits
+    if (syscall(SYS_mbind, pmem, range.size(), mode, mask.data(),
+                mask.size() * bits + 1, 0) != 0) {
+        warn("Could not apply the NUMA policy to range %s: %s\n",
+             range.to_string(), strerror(errno));
+    } else {
+        string node_list;
+        for (auto node : nodes)
+            node_list += (node_list.empty() ? "" : ",") + to_string(node);
+        add(csprintf("NUMA %s on node(s) %s",
+            BackingStoreNumaPolicyStrings[static_cast<int>(numaPolicy)],
+            node_list));
+    }
+#else
+    warn("NUMA policies are not supported on this host\n");
+#endif
+
+    return applied;
+}
+
 PhysicalMemory::~PhysicalMemory()
 {
     // unmap the backing store
@@ -299,6 +417,19 @@ PhysicalMemory::access(PacketPtr pkt)
     m->second->access(pkt);
 }
 
+uint8_t *
+PhysicalMemory::getHostPtr(Addr addr, Addr size) const
+{
+    assert(size);
+    for (const auto& entry : backingStore) {
+        if (entry.inAddrMap && entry.range.contains(addr) &&
+            entry.range.contains(addr + size - 1)) {
+            return entry.pmem + (addr - entry.range.start());
+        }
+    }
+    return nullptr;
+}
+
 void
 PhysicalMemory::functionalAccess(PacketPtr pkt)
 {
@@ -316,7 +447,7 @@ PhysicalMemory::serialize(CheckpointOut &cp) const
     vector<ContextID> lal_cid;
 
     for (auto& m : memories) {
-        const list<LockedAddr>& locked_addrs = m->getLockedAddrList();
+        const list<LockedAddr> locked_addrs = m->getLockedAddrList();
         for (const auto& l : locked_addrs) {
             lal_addr.push_back(l.addr);
             lal_cid.push_back(l.contextId);
@@ -354,9 +485,19 @@ PhysicalMemory::serializeStore(CheckpointOut &cp, unsigned int store_id,
     SERIALIZE_SCALAR(filename);
     SERIALIZE_SCALAR(range_size);
 
-    // write memory file
+    // write memory file, the "T" mode writes it without compression
+    // but it is still read back through zlib
     string filepath = CheckpointIn::dir() + "/" + filename.c_str();
-    gzFile compressed_mem = gzopen(filepath.c_str(), "wb");
+
+    // a lazily restored store may still be mapped from a file of the
+    // same name, so replace the file rather than truncating it under
+    // the mapping
+    if (unlink(filepath.c_str()) == -1 && errno != ENOENT)
+        fatal("Can't remove old physical memory checkpoint file '%s': %s\n",
+              filename, strerror(errno));
+
+    gzFile compressed_mem = gzopen(filepath.c_str(),
+                                   compressStores ? "wb" : "wbT");
     if (compressed_mem == NULL)
         fatal("Can't open physical memory checkpoint file '%s'\n",
               filename);
@@ -421,11 +562,6 @@ PhysicalMemory::unserializeStore(CheckpointIn &cp)
     UNSERIALIZE_SCALAR(filename);
     string filepath = cp.getCptDir() + "/" + filename;
 
-    // mmap memoryfile
-    gzFile compressed_mem = gzopen(filepath.c_str(), "rb");
-    if (compressed_mem == NULL)
-        fatal("Can't open physical memory checkpoint file '%s'", filename);
-
     // we've already got the actual backing store mapped
     uint8_t* pmem = backingStore[store_id].pmem;
     AddrRange range = backingStore[store_id].range;
@@ -440,6 +576,13 @@ PhysicalMemory::unserializeStore(CheckpointIn &cp)
         fatal("Memory range size has changed! Saw %lld, expected %lld\n",
               range_size, range.size());
 
+    if (lazyRestore && mapStore(filepath, backingStore[store_id]))
+        return;
+
+    gzFile compressed_mem = gzopen(filepath.c_str(), "rb");
+    if (compressed_mem == NULL)
+        fatal("Can't open physical memory checkpoint file '%s'", filename);
+
     uint64_t curr_size = 0;
     long* temp_page = new long[chunk_size];
     long* pmem_current;
@@ -468,3 +611,62 @@ PhysicalMemory::unserializeStore(CheckpointIn &cp)
         fatal("Close failed on physical memory checkpoint file '%s'\n",
               filename);
 }
+
+bool
+PhysicalMemory::mapStore(const string &filepath,
+                         const BackingStoreEntry &store)
+{
+    if (!sharedBackstore.empty()) {
+        warn("Can't lazily restore %s into a shared backing store, "
+             "reading it instead\n", filepath);
+        return false;
+    }
+
+    if (hugePages == BackingStoreHugePages::hugetlb) {
+        warn("Can't lazily restore %s into hugetlb pages, reading it "
+             "instead\n", filepath);
+        return false;
+    }
+
+    int fd = open(filepath.c_str(), O_RDONLY);
+    if (fd == -1)
+        return false;
+
+    // compressed stores start with the gzip magic
+    uint8_t magic[2];
+    struct stat st;
+    if (pread(fd, magic, sizeof(magic), 0) != sizeof(magic) ||
+        (magic[0] == 0x1f && magic[1] == 0x8b) ||
+        fstat(fd, &st) == -1 || st.st_size != store.range.size() ||
+        store.range.size() % sysconf(_SC_PAGESIZE) != 0) {
+        close(fd);
+        warn("Can't lazily restore %s since it isn't an uncompressed "
+             "store, reading it instead\n", filepath);
+        return false;
+    }
+
+    DPRINTF(Checkpoint, "Mapping %s copy-on-write over the backing store\n",
+            filepath);
+
+    // replace the anonymous mapping in place so that the memories
+    // keep pointing to the same backing store
+    int map_flags = MAP_PRIVATE | MAP_FIXED;
+    if (mmapUsingNoReserve)
+        map_flags |= MAP_NORESERVE;
+
+    void *pmem = mmap(store.pmem, store.range.size(),
+                      PROT_READ | PROT_WRITE, map_flags, fd, 0);
+    close(fd);
+
+    if (pmem == MAP_FAILED) {
+        perror("mmap");
+        fatal("Could not mmap %s for range %s!\n", filepath,
+              store.range.to_string());
+    }
+
+    // the policies of the anonymous mapping were replaced as well
+    unsigned store_id = &store - &backingStore[0];
+    applyHostPolicy(store.pmem, store.range, store_id, false);
+
+    return true;
+}
@@ -38,7 +38,12 @@
 #ifndef __MEM_PHYSICAL_HH__
 #define __MEM_PHYSICAL_HH__
 
+#include <string>
+#include <vector>
+
 #include "base/addr_range_map.hh"
+#include "enums/BackingStoreHugePages.hh"
+#include "enums/BackingStoreNumaPolicy.hh"
 #include "mem/packet.hh"
 
 /**
@@ -129,6 +134,20 @@ class PhysicalMemory : public Serializable
 
     const std::string sharedBackstore;
 
+    // Write the memory stores of checkpoints compressed
+    const bool compressStores;
+
+    // Map uncompressed stores copy-on-write rather than reading them
+    // when restoring a checkpoint
+    const bool lazyRestore;
+
+    // Host huge pages used for the backing store
+    const BackingStoreHugePages hugePages;
+
+    // Host NUMA policy of the backing store, and the nodes it applies to
+    const BackingStoreNumaPolicy numaPolicy;
+    const std::vector<unsigned> numaNodes;
+
     // The physical memory used to provide the memory in the simulated
     // system
     std::vector<BackingStoreEntry> backingStore;
@@ -153,6 +172,19 @@ class PhysicalMemory : public Serializable
                             bool conf_table_reported,
                             bool in_addr_map, bool kvm_map);
 
+    /**
+     * Apply the huge page and NUMA policies to a backing store. This
+     * has to be done before any of its pages are touched.
+     *
+     * @param pmem Host pointer to the backing store
+     * @param range The address range of the backing store
+     * @param store_id Index of the backing store
+     * @param huge_tlb Whether the store is mapped with hugetlb pages
+     * @return A description of the policies applied, for reporting
+     */
+    std::string applyHostPolicy(uint8_t *pmem, const AddrRange &range,
+                                unsigned store_id, bool huge_tlb) const;
+
   public:
 
     /**
@@ -161,7 +193,14 @@ class PhysicalMemory : public Serializable
     PhysicalMemory(const std::string& _name,
                    const std::vector<AbstractMemory*>& _memories,
                    bool mmap_using_noreserve,
-                   const std::string& shared_backstore);
+                   const std::string& shared_backstore,
+                   bool compress_stores = true,
+                   bool lazy_restore = false,
+                   BackingStoreHugePages huge_pages =
+                       BackingStoreHugePages::none,
+                   BackingStoreNumaPolicy numa_policy =
+                       BackingStoreNumaPolicy::none,
+                   const std::vector<unsigned> &numa_nodes = {});
 
     /**
      * Unmap all the backing store we have used.
@@ -215,6 +254,17 @@ class PhysicalMemory : public Serializable
     std::vector<BackingStoreEntry> getBackingStore() const
     { return backingStore; }
 
+    /**
+     * Get a host pointer to a range of the global address map, for
+     * bulk functional accesses that bypass the memory system.
+     *
+     * @param addr Start address of the range
+     * @param size Size of the range in bytes
+     * @return Pointer to the backing store of the range, or nullptr
+     *         if the range is not covered by a single backing store
+     */
+    uint8_t *getHostPtr(Addr addr, Addr size) const;
+
     /**
      * Perform an untimed memory access and update all the state
      * (e.g. locked addresses) and statistics accordingly. The packet
@@ -266,6 +316,18 @@ class PhysicalMemory : public Serializable
      */
     void unserializeStore(CheckpointIn &cp);
 
+    /**
+     * Map an uncompressed store file over a backing store. The file is
+     * mapped privately, so pages are only read from the file when they
+     * are first touched, and writes never reach the file.
+     *
+     * @param filepath Path of the store file
+     * @param store The backing store to replace
+     * @return True if the file was mapped, false if it has to be read
+     */
+    bool mapStore(const std::string &filepath,
+                  const BackingStoreEntry &store);
+
 };
 
 #endif //__MEM_PHYSICAL_HH__
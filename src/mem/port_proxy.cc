@@ -37,11 +37,14 @@
 
 #include "mem/port_proxy.hh"
 
+#include <algorithm>
+#include <cstring>
+
 #include "base/chunk_generator.hh"
 
 void
-PortProxy::readBlobPhys(Addr addr, Request::Flags flags,
-                        void *p, int size) const
+PortProxy::readLinesPhys(Addr addr, Request::Flags flags,
+                         void *p, int size) const
 {
     for (ChunkGenerator gen(addr, size, _cacheLineSize); !gen.done();
          gen.next()) {
@@ -57,8 +60,8 @@ PortProxy::readBlobPhys(Addr addr, Request::Flags flags,
 }
 
 void
-PortProxy::writeBlobPhys(Addr addr, Request::Flags flags,
-                         const void *p, int size) const
+PortProxy::writeLinesPhys(Addr addr, Request::Flags flags,
+                          const void *p, int size) const
 {
     for (ChunkGenerator gen(addr, size, _cacheLineSize); !gen.done();
          gen.next()) {
@@ -73,6 +76,80 @@ PortProxy::writeBlobPhys(Addr addr, Request::Flags flags,
     }
 }
 
+void
+PortProxy::readBlobPhys(Addr addr, Request::Flags flags,
+                        void *p, int size) const
+{
+    if (!canBulkAccess(flags)) {
+        readLinesPhys(addr, flags, p, size);
+        return;
+    }
+
+    std::vector<Addr> held_lines;
+    for (ChunkGenerator gen(addr, size, BulkAccessSize); !gen.done();
+         gen.next()) {
+        uint8_t *dst = static_cast<uint8_t *>(p) + gen.complete();
+
+        held_lines.clear();
+        const uint8_t *src = bulkAccess(gen.addr(), gen.size(), held_lines);
+        if (!src) {
+            readLinesPhys(gen.addr(), flags, dst, gen.size());
+            continue;
+        }
+
+        std::memcpy(dst, src, gen.size());
+
+        // Lines held elsewhere may be more recent than the backing
+        // store, so read them through the memory system
+        const Addr end = gen.addr() + gen.size();
+        for (Addr line : held_lines) {
+            const Addr start = std::max(line, gen.addr());
+            const Addr stop = std::min<Addr>(line + _cacheLineSize, end);
+            if (start < stop) {
+                readLinesPhys(start, flags, dst + (start - gen.addr()),
+                              stop - start);
+            }
+        }
+    }
+}
+
+void
+PortProxy::writeBlobPhys(Addr addr, Request::Flags flags,
+                         const void *p, int size) const
+{
+    if (!canBulkAccess(flags)) {
+        writeLinesPhys(addr, flags, p, size);
+        return;
+    }
+
+    std::vector<Addr> held_lines;
+    for (ChunkGenerator gen(addr, size, BulkAccessSize); !gen.done();
+         gen.next()) {
+        const uint8_t *src =
+            static_cast<const uint8_t *>(p) + gen.complete();
+
+        held_lines.clear();
+        uint8_t *dst = bulkAccess(gen.addr(), gen.size(), held_lines);
+        if (!dst) {
+            writeLinesPhys(gen.addr(), flags, src, gen.size());
+            continue;
+        }
+
+        std::memcpy(dst, src, gen.size());
+
+        // Update the copies held elsewhere as well
+        const Addr end = gen.addr() + gen.size();
+        for (Addr line : held_lines) {
+            const Addr start = std::max(line, gen.addr());
+            const Addr stop = std::min<Addr>(line + _cacheLineSize, end);
+            if (start < stop) {
+                writeLinesPhys(start, flags, src + (start - gen.addr()),
+                               stop - start);
+            }
+        }
+    }
+}
+
 void
 PortProxy::memsetBlobPhys(Addr addr, Request::Flags flags,
                           uint8_t v, int size) const
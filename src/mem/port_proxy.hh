@@ -59,6 +59,7 @@
 
 #include <functional>
 #include <limits>
+#include <vector>
 
 #include "mem/port.hh"
 #include "sim/byteswap.hh"
@@ -82,12 +83,47 @@ class PortProxy : FunctionalRequestProtocol
   public:
     typedef std::function<void(PacketPtr pkt)> SendFunctionalFunc;
 
+    /**
+     * Get direct access to the backing store of an address range.
+     * Returns a host pointer to the range, and appends to the vector
+     * the lines that must still go through the memory system, or
+     * returns nullptr if the whole range must.
+     */
+    typedef std::function<uint8_t *(Addr addr, Addr size,
+                                    std::vector<Addr> &held_lines)>
+        BulkAccessFunc;
+
   private:
     SendFunctionalFunc sendFunctional;
 
+    /** Optional direct access to the backing store. */
+    BulkAccessFunc bulkAccess;
+
     /** Granularity of any transactions issued through this proxy. */
     const unsigned int _cacheLineSize;
 
+    /** Granularity of the bulk accesses to the backing store. */
+    static const Addr BulkAccessSize = 4096;
+
+    /** Line-granular functional read of physical memory. */
+    void readLinesPhys(Addr addr, Request::Flags flags,
+                       void *p, int size) const;
+
+    /** Line-granular functional write of physical memory. */
+    void writeLinesPhys(Addr addr, Request::Flags flags,
+                        const void *p, int size) const;
+
+    /**
+     * Check whether an access may bypass the memory system for the
+     * lines that no one holds.
+     */
+    bool
+    canBulkAccess(Request::Flags flags) const
+    {
+        return bulkAccess &&
+            !flags.isSet(Request::UNCACHEABLE | Request::STRICT_ORDER);
+    }
+
     void
     recvFunctionalSnoop(PacketPtr pkt) override
     {
@@ -97,13 +133,16 @@ class PortProxy : FunctionalRequestProtocol
     }
 
   public:
-    PortProxy(SendFunctionalFunc func, unsigned int cacheLineSize) :
-        sendFunctional(func), _cacheLineSize(cacheLineSize)
+    PortProxy(SendFunctionalFunc func, unsigned int cacheLineSize,
+              BulkAccessFunc bulk_access = nullptr) :
+        sendFunctional(func), bulkAccess(bulk_access),
+        _cacheLineSize(cacheLineSize)
     {}
-    PortProxy(const RequestPort &port, unsigned int cacheLineSize) :
+    PortProxy(const RequestPort &port, unsigned int cacheLineSize,
+              BulkAccessFunc bulk_access = nullptr) :
         sendFunctional([&port](PacketPtr pkt)->void {
                 port.sendFunctional(pkt);
-            }), _cacheLineSize(cacheLineSize)
+            }), bulkAccess(bulk_access), _cacheLineSize(cacheLineSize)
     {}
     virtual ~PortProxy() { }
 
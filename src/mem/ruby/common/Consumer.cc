@@ -28,6 +28,8 @@
 
 #include "mem/ruby/common/Consumer.hh"
 
+#include "base/logging.hh"
+
 using namespace std;
 
 void
@@ -39,6 +41,12 @@ Consumer::scheduleEvent(Cycles timeDelta)
 void
 Consumer::scheduleEventAbsolute(Tick evt_time)
 {
+    if (isRemote()) {
+        scheduleHandoff(evt_time,
+                        [this, evt_time]{ scheduleEventAbsolute(evt_time); });
+        return;
+    }
+
     if (!alreadyScheduled(evt_time)) {
         // This wakeup is not redundant
         auto *evt = new EventFunctionWrapper(
@@ -53,3 +61,20 @@ Consumer::scheduleEventAbsolute(Tick evt_time)
     set<Tick>::iterator eit = m_scheduled_wakeups.lower_bound(t);
     m_scheduled_wakeups.erase(bit,eit);
 }
+
+void
+Consumer::scheduleHandoff(Tick evt_time, std::function<void()> callback)
+{
+    panic_if(evt_time < curTick() + simQuantum,
+             "%s: cross-queue wakeup at tick %d from tick %d is closer than "
+             "the simulation quantum (%d). Cross-queue links need a latency "
+             "of at least sim_quantum.\n",
+             em->name(), evt_time, curTick(), simQuantum);
+
+    // The owning queue may be running concurrently. Scheduling into it
+    // from here goes through its asynchronous insertion list, and the
+    // function then runs on the owning thread.
+    auto *evt = new EventFunctionWrapper(callback, "Consumer Handoff Event",
+                                         true);
+    em->schedule(evt, evt_time);
+}
@@ -35,6 +35,7 @@
 #ifndef __MEM_RUBY_COMMON_CONSUMER_HH__
 #define __MEM_RUBY_COMMON_CONSUMER_HH__
 
+#include <functional>
 #include <iostream>
 #include <set>
 
@@ -78,6 +79,28 @@ class Consumer
     void scheduleEventAbsolute(Tick timeAbs);
     void scheduleEvent(Cycles timeDelta);
 
+    /**
+     * Check if the caller runs on a different event queue than this
+     * consumer. The wakeup bookkeeping is only ever touched by the
+     * owning thread, so remote callers have to go through
+     * scheduleHandoff().
+     */
+    bool
+    isRemote() const
+    {
+        return inParallelMode && curEventQueue() != em->eventQueue();
+    }
+
+    /**
+     * Run a function on the event queue of this consumer at the given
+     * time. The time has to be at least one simulation quantum ahead,
+     * which is what keeps the owning queue from having passed it.
+     *
+     * @param evt_time Absolute time at which to run the function.
+     * @param callback Function to run on the owning thread.
+     */
+    void scheduleHandoff(Tick evt_time, std::function<void()> callback);
+
   private:
     std::set<Tick> m_scheduled_wakeups;
     ClockedObject *em;
@@ -28,39 +28,85 @@
 
 #include "mem/ruby/common/DataBlock.hh"
 
+#include <new>
+
 #include "mem/ruby/common/WriteMask.hh"
 #include "mem/ruby/system/RubySystem.hh"
 
 DataBlock::DataBlock(const DataBlock &cp)
 {
-    m_data = new uint8_t[RubySystem::getBlockSizeBytes()];
-    memcpy(m_data, cp.m_data, RubySystem::getBlockSizeBytes());
-    m_alloc = true;
+    if (cp.m_storage) {
+        // Share the storage until either block is modified
+        m_storage = cp.m_storage;
+        m_storage->refs.fetch_add(1, std::memory_order_relaxed);
+        m_data = cp.m_data;
+    } else {
+        allocStorage();
+        memcpy(m_data, cp.m_data, RubySystem::getBlockSizeBytes());
+    }
 }
 
 void
 DataBlock::alloc()
 {
-    m_data = new uint8_t[RubySystem::getBlockSizeBytes()];
-    m_alloc = true;
+    allocStorage();
     clear();
 }
 
+void
+DataBlock::allocStorage()
+{
+    void *mem = ::operator new(sizeof(Storage) +
+                               RubySystem::getBlockSizeBytes());
+    m_storage = new (mem) Storage;
+    m_storage->refs.store(1, std::memory_order_relaxed);
+    m_data = reinterpret_cast<uint8_t *>(m_storage + 1);
+}
+
+void
+DataBlock::release()
+{
+    if (m_storage &&
+        m_storage->refs.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+        m_storage->~Storage();
+        ::operator delete(m_storage);
+    }
+    m_storage = nullptr;
+}
+
+void
+DataBlock::unshare()
+{
+    const uint8_t *shared_data = m_data;
+    Storage *shared_storage = m_storage;
+    allocStorage();
+    memcpy(m_data, shared_data, RubySystem::getBlockSizeBytes());
+
+    // Another copy may have dropped the storage in the meantime
+    if (shared_storage->refs.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+        shared_storage->~Storage();
+        ::operator delete(shared_storage);
+    }
+}
+
 void
 DataBlock::clear()
 {
+    makeUnique();
     memset(m_data, 0, RubySystem::getBlockSizeBytes());
 }
 
 bool
 DataBlock::equal(const DataBlock& obj) const
 {
-    return !memcmp(m_data, obj.m_data, RubySystem::getBlockSizeBytes());
+    return (m_data == obj.m_data) ||
+        !memcmp(m_data, obj.m_data, RubySystem::getBlockSizeBytes());
 }
 
 void
 DataBlock::copyPartial(const DataBlock &dblk, const WriteMask &mask)
 {
+    makeUnique();
     for (int i = 0; i < RubySystem::getBlockSizeBytes(); i++) {
         if (mask.getMask(i, 1)) {
             m_data[i] = dblk.m_data[i];
@@ -71,6 +117,7 @@ DataBlock::copyPartial(const DataBlock &dblk, const WriteMask &mask)
 void
 DataBlock::atomicPartial(const DataBlock &dblk, const WriteMask &mask)
 {
+    makeUnique();
     for (int i = 0; i < RubySystem::getBlockSizeBytes(); i++) {
         m_data[i] = dblk.m_data[i];
     }
@@ -101,18 +148,34 @@ DataBlock::getData(int offset, int len) const
 uint8_t*
 DataBlock::getDataMod(int offset)
 {
+    makeUnique();
     return &m_data[offset];
 }
 
 void
 DataBlock::setData(const uint8_t *data, int offset, int len)
 {
+    makeUnique();
     memcpy(&m_data[offset], data, len);
 }
 
 DataBlock &
 DataBlock::operator=(const DataBlock & obj)
 {
-    memcpy(m_data, obj.m_data, RubySystem::getBlockSizeBytes());
+    if (m_data == obj.m_data) {
+        return *this;
+    }
+
+    if (m_storage && obj.m_storage) {
+        // Share the storage of the other block instead of copying it
+        obj.m_storage->refs.fetch_add(1, std::memory_order_relaxed);
+        release();
+        m_storage = obj.m_storage;
+        m_data = obj.m_data;
+    } else {
+        // Assigned data is written in place
+        makeUnique();
+        memcpy(m_data, obj.m_data, RubySystem::getBlockSizeBytes());
+    }
     return *this;
 }
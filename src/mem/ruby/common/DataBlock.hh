@@ -31,12 +31,19 @@
 
 #include <inttypes.h>
 
+#include <atomic>
 #include <cassert>
+#include <cstddef>
 #include <iomanip>
 #include <iostream>
 
 class WriteMask;
 
+/**
+ * The data of a cache block. Copies of a block share their storage until
+ * one of them is modified, so that copying messages and blocks around,
+ * e.g., for multicasts, does not copy the data.
+ */
 class DataBlock
 {
   public:
@@ -49,8 +56,7 @@ class DataBlock
 
     ~DataBlock()
     {
-        if (m_alloc)
-            delete [] m_data;
+        release();
     }
 
     DataBlock& operator=(const DataBlock& obj);
@@ -70,20 +76,46 @@ class DataBlock
     void print(std::ostream& out) const;
 
   private:
+    /**
+     * Header of the storage of a block. The data follows the header in
+     * the same allocation. The reference count is atomic, as copies of a
+     * block may live on different event queues.
+     */
+    struct alignas(alignof(std::max_align_t)) Storage
+    {
+        std::atomic<unsigned> refs;
+    };
+
     void alloc();
+
+    /** Allocate new storage for the block, leaving the data undefined. */
+    void allocStorage();
+
+    /** Drop the reference to the storage of the block, if it owns one. */
+    void release();
+
+    /** Make sure the storage is not shared before modifying the data. */
+    void
+    makeUnique()
+    {
+        if (m_storage && m_storage->refs.load(std::memory_order_acquire) > 1)
+            unshare();
+    }
+
+    void unshare();
+
     uint8_t *m_data;
-    bool m_alloc;
+    //! Storage holding m_data, or nullptr if the data was assigned
+    Storage *m_storage;
 };
 
 inline void
 DataBlock::assign(uint8_t *data)
 {
     assert(data != NULL);
-    if (m_alloc) {
-        delete [] m_data;
-    }
+    release();
     m_data = data;
-    m_alloc = false;
+    m_storage = nullptr;
 }
 
 inline uint8_t
@@ -95,6 +127,7 @@ DataBlock::getByte(int whichByte) const
 inline void
 DataBlock::setByte(int whichByte, uint8_t data)
 {
+    makeUnique();
     m_data[whichByte] = data;
 }
 
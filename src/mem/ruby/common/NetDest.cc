@@ -106,13 +106,11 @@ std::vector<NodeID>
 NetDest::getAllDest()
 {
     std::vector<NodeID> dest;
-    dest.clear();
     for (int i = 0; i < m_bits.size(); i++) {
-        for (int j = 0; j < m_bits[i].getSize(); j++) {
-            if (m_bits[i].isElement(j)) {
-                int id = MachineType_base_number((MachineType)i) + j;
-                dest.push_back((NodeID)id);
-            }
+        int base = MachineType_base_number((MachineType)i);
+        for (int j = m_bits[i].nextElement(0); j >= 0;
+             j = m_bits[i].nextElement(j + 1)) {
+            dest.push_back((NodeID)(base + j));
         }
     }
     return dest;
@@ -139,11 +137,10 @@ NetDest::smallestElement() const
 {
     assert(count() > 0);
     for (int i = 0; i < m_bits.size(); i++) {
-        for (NodeID j = 0; j < m_bits[i].getSize(); j++) {
-            if (m_bits[i].isElement(j)) {
-                MachineID mach = {MachineType_from_base_level(i), j};
-                return mach;
-            }
+        int j = m_bits[i].nextElement(0);
+        if (j >= 0) {
+            MachineID mach = {MachineType_from_base_level(i), (NodeID)j};
+            return mach;
         }
     }
     panic("No smallest element of an empty set.");
@@ -152,12 +149,10 @@ NetDest::smallestElement() const
 MachineID
 NetDest::smallestElement(MachineType machine) const
 {
-    int size = m_bits[MachineType_base_level(machine)].getSize();
-    for (NodeID j = 0; j < size; j++) {
-        if (m_bits[MachineType_base_level(machine)].isElement(j)) {
-            MachineID mach = {machine, j};
-            return mach;
-        }
+    int j = m_bits[MachineType_base_level(machine)].nextElement(0);
+    if (j >= 0) {
+        MachineID mach = {machine, (NodeID)j};
+        return mach;
     }
 
     panic("No smallest element of given MachineType.");
@@ -192,10 +187,8 @@ NetDest
 NetDest::OR(const NetDest& orNetDest) const
 {
     assert(m_bits.size() == orNetDest.getSize());
-    NetDest result;
-    for (int i = 0; i < m_bits.size(); i++) {
-        result.m_bits[i] = m_bits[i].OR(orNetDest.m_bits[i]);
-    }
+    NetDest result(*this);
+    result.addNetDest(orNetDest);
     return result;
 }
 
@@ -204,7 +197,7 @@ NetDest
 NetDest::AND(const NetDest& andNetDest) const
 {
     assert(m_bits.size() == andNetDest.getSize());
-    NetDest result;
+    NetDest result(*this);
     for (int i = 0; i < m_bits.size(); i++) {
         result.m_bits[i] = m_bits[i].AND(andNetDest.m_bits[i]);
     }
@@ -246,8 +239,7 @@ NetDest::isElement(MachineID element) const
 void
 NetDest::resize()
 {
-    m_bits.resize(MachineType_base_level(MachineType_NUM));
-    assert(m_bits.size() == MachineType_NUM);
+    assert(MachineType_base_level(MachineType_NUM) == m_bits.size());
 
     for (int i = 0; i < m_bits.size(); i++) {
         m_bits[i].setSize(MachineType_base_count((MachineType)i));
@@ -29,6 +29,7 @@
 #ifndef __MEM_RUBY_COMMON_NETDEST_HH__
 #define __MEM_RUBY_COMMON_NETDEST_HH__
 
+#include <array>
 #include <iostream>
 #include <vector>
 
@@ -105,7 +106,10 @@ class NetDest
 
     NodeID bitIndex(NodeID index) const { return index; }
 
-    std::vector<Set> m_bits;  // a vector of bit vectors - i.e. Sets
+    // One bit vector (Set) per machine type. MachineType_NUM is fixed by
+    // the protocol, so the Sets are stored inline and a NetDest never
+    // allocates.
+    std::array<Set, MachineType_NUM> m_bits;
 };
 
 inline std::ostream&
@@ -32,23 +32,42 @@
 #ifndef __MEM_RUBY_COMMON_SET_HH__
 #define __MEM_RUBY_COMMON_SET_HH__
 
-#include <bitset>
 #include <cassert>
+#include <cstdint>
 #include <iostream>
 
+#include "base/bitfield.hh"
 #include "base/logging.hh"
 #include "mem/ruby/common/TypeDefines.hh"
 
+/*
+ * A fixed-width bit vector of NUMBER_BITS_PER_SET bits. The bits are kept
+ * inline as an array of 64-bit words so that copying a Set never touches
+ * the heap, and all of the set operations below are straight loops over
+ * the words which the compiler is free to unroll and vectorize. With the
+ * default width a Set is a single word.
+ */
 class Set
 {
   private:
+    static constexpr int bitsPerWord = 64;
+    static constexpr int numWords =
+        (NUMBER_BITS_PER_SET + bitsPerWord - 1) / bitsPerWord;
+
     // Number of bits in use in this set.
     // can be defined in build_opts file (default=64).
     int m_nSize;
-    std::bitset<NUMBER_BITS_PER_SET> bits;
+    uint64_t m_words[numWords];
+
+    static int wordIndex(NodeID index) { return index / bitsPerWord; }
+    static uint64_t
+    wordMask(NodeID index)
+    {
+        return (uint64_t)1 << (index % bitsPerWord);
+    }
 
   public:
-    Set() : m_nSize(0) {}
+    Set() : m_nSize(0) { clear(); }
 
     Set(int size) : m_nSize(size)
     {
@@ -56,22 +75,19 @@ class Set
             fatal("Number of bits(%d) < size specified(%d). "
                   "Increase the number of bits and recompile.\n",
                   NUMBER_BITS_PER_SET, size);
+        clear();
     }
 
-    Set(const Set& obj) : m_nSize(obj.m_nSize), bits(obj.bits) {}
+    Set(const Set& obj) = default;
     ~Set() {}
 
-    Set& operator=(const Set& obj)
-    {
-        m_nSize = obj.m_nSize;
-        bits = obj.bits;
-        return *this;
-    }
+    Set& operator=(const Set& obj) = default;
 
     void
     add(NodeID index)
     {
-        bits.set(index);
+        assert((int)index < NUMBER_BITS_PER_SET);
+        m_words[wordIndex(index)] |= wordMask(index);
     }
 
     /*
@@ -82,7 +98,8 @@ class Set
     addSet(const Set& obj)
     {
         assert(m_nSize == obj.m_nSize);
-        bits |= obj.bits;
+        for (int i = 0; i < numWords; ++i)
+            m_words[i] |= obj.m_words[i];
     }
 
     /*
@@ -91,7 +108,8 @@ class Set
     void
     remove(NodeID index)
     {
-        bits.reset(index);
+        assert((int)index < NUMBER_BITS_PER_SET);
+        m_words[wordIndex(index)] &= ~wordMask(index);
     }
 
     /*
@@ -101,26 +119,44 @@ class Set
     removeSet(const Set& obj)
     {
         assert(m_nSize == obj.m_nSize);
-        bits &= (~obj.bits);
+        for (int i = 0; i < numWords; ++i)
+            m_words[i] &= ~obj.m_words[i];
     }
 
-    void clear() { bits.reset(); }
+    void
+    clear()
+    {
+        for (int i = 0; i < numWords; ++i)
+            m_words[i] = 0;
+    }
 
     /*
      * this function sets all bits in the set
      */
     void broadcast()
     {
-        bits.set();
-        for (int j = m_nSize; j < NUMBER_BITS_PER_SET; ++j) {
-            bits.reset(j);
+        for (int i = 0; i < numWords; ++i) {
+            int lo = i * bitsPerWord;
+            if (m_nSize >= lo + bitsPerWord)
+                m_words[i] = ~(uint64_t)0;
+            else if (m_nSize > lo)
+                m_words[i] = mask(m_nSize - lo);
+            else
+                m_words[i] = 0;
         }
     }
 
     /*
      * This function returns the population count of 1's in the set
      */
-    int count() const { return bits.count(); }
+    int
+    count() const
+    {
+        int counter = 0;
+        for (int i = 0; i < numWords; ++i)
+            counter += popCount(m_words[i]);
+        return counter;
+    }
 
     /*
      * This function checks for set equality
@@ -129,7 +165,10 @@ class Set
     isEqual(const Set& obj) const
     {
         assert(m_nSize == obj.m_nSize);
-        return bits == obj.bits;
+        uint64_t diff = 0;
+        for (int i = 0; i < numWords; ++i)
+            diff |= m_words[i] ^ obj.m_words[i];
+        return diff == 0;
     }
 
     // return the logical OR of this set and orSet
@@ -137,8 +176,8 @@ class Set
     OR(const Set& obj) const
     {
         assert(m_nSize == obj.m_nSize);
-        Set r(m_nSize);
-        r.bits = bits | obj.bits;
+        Set r(*this);
+        r.addSet(obj);
         return r;
     };
 
@@ -147,8 +186,9 @@ class Set
     AND(const Set& obj) const
     {
         assert(m_nSize == obj.m_nSize);
-        Set r(m_nSize);
-        r.bits = bits & obj.bits;
+        Set r(*this);
+        for (int i = 0; i < numWords; ++i)
+            r.m_words[i] &= obj.m_words[i];
         return r;
     }
 
@@ -156,8 +196,10 @@ class Set
     bool
     intersectionIsEmpty(const Set& obj) const
     {
-        std::bitset<NUMBER_BITS_PER_SET> r = bits & obj.bits;
-        return r.none();
+        uint64_t r = 0;
+        for (int i = 0; i < numWords; ++i)
+            r |= m_words[i] & obj.m_words[i];
+        return r == 0;
     }
 
     /*
@@ -168,13 +210,20 @@ class Set
     isSuperset(const Set& test) const
     {
         assert(m_nSize == test.m_nSize);
-        std::bitset<NUMBER_BITS_PER_SET> r = bits | test.bits;
-        return (r == bits);
+        uint64_t r = 0;
+        for (int i = 0; i < numWords; ++i)
+            r |= test.m_words[i] & ~m_words[i];
+        return r == 0;
     }
 
     bool isSubset(const Set& test) const { return test.isSuperset(*this); }
 
-    bool isElement(NodeID element) const { return bits.test(element); }
+    bool
+    isElement(NodeID element) const
+    {
+        assert((int)element < NUMBER_BITS_PER_SET);
+        return m_words[wordIndex(element)] & wordMask(element);
+    }
 
     /*
      * this function returns true iff all bits in use are set
@@ -182,22 +231,50 @@ class Set
     bool
     isBroadcast() const
     {
-        return (bits.count() == m_nSize);
+        return (count() == m_nSize);
     }
 
-    bool isEmpty() const { return bits.none(); }
+    bool
+    isEmpty() const
+    {
+        uint64_t r = 0;
+        for (int i = 0; i < numWords; ++i)
+            r |= m_words[i];
+        return r == 0;
+    }
 
-    NodeID smallestElement() const
+    /*
+     * Returns the smallest element that is >= index, or -1 if there is
+     * no such element. Lets callers walk the members of a sparse set
+     * without testing every bit.
+     */
+    int
+    nextElement(NodeID index) const
     {
-        for (int i = 0; i < m_nSize; ++i) {
-            if (bits.test(i)) {
-                return i;
+        if ((int)index >= m_nSize)
+            return -1;
+        int i = wordIndex(index);
+        uint64_t word = m_words[i] & ~mask(index % bitsPerWord);
+        while (true) {
+            if (word) {
+                int element = i * bitsPerWord + findLsbSet(word);
+                return element < m_nSize ? element : -1;
             }
+            if (++i == numWords)
+                return -1;
+            word = m_words[i];
         }
+    }
+
+    NodeID smallestElement() const
+    {
+        int element = nextElement(0);
+        if (element >= 0)
+            return element;
         panic("No smallest element of an empty set.");
     }
 
-    bool elementAt(int index) const { return bits[index]; }
+    bool elementAt(int index) const { return isElement(index); }
 
     int getSize() const { return m_nSize; }
 
@@ -209,12 +286,15 @@ class Set
                   "Increase the number of bits and recompile.\n",
                   NUMBER_BITS_PER_SET, size);
         m_nSize = size;
-        bits.reset();
+        clear();
     }
 
     void print(std::ostream& out) const
     {
-        out << "[Set (" << m_nSize << "): " << bits << "]";
+        out << "[Set (" << m_nSize << "): ";
+        for (int i = NUMBER_BITS_PER_SET - 1; i >= 0; --i)
+            out << (isElement(i) ? '1' : '0');
+        out << "]";
     }
 };
 
@@ -41,6 +41,7 @@
 #include "mem/ruby/network/MessageBuffer.hh"
 
 #include <cassert>
+#include <mutex>
 
 #include "base/cprintf.hh"
 #include "base/logging.hh"
@@ -67,7 +68,8 @@ MessageBuffer::MessageBuffer(const Params *p)
     m_msgs_this_cycle = 0;
     m_priority_rank = 0;
 
-    m_stall_msg_map.clear();
+    m_num_msgs = 0;
+    m_free_stall_node = -1;
     m_input_link_id = 0;
     m_vnet_id = 0;
 
@@ -75,14 +77,16 @@ MessageBuffer::MessageBuffer(const Params *p)
     m_stall_time = 0;
 
     m_dequeue_callback = nullptr;
+    m_dequeue_callback_queue = nullptr;
 }
 
 unsigned int
 MessageBuffer::getSize(Tick curTime)
 {
+    auto lock = parallelLock();
     if (m_time_last_time_size_checked != curTime) {
         m_time_last_time_size_checked = curTime;
-        m_size_last_time_size_checked = m_prio_heap.size();
+        m_size_last_time_size_checked = m_num_msgs;
     }
 
     return m_size_last_time_size_checked;
@@ -97,6 +101,14 @@ MessageBuffer::areNSlotsAvailable(unsigned int n, Tick current_time)
         return true;
     }
 
+    auto lock = parallelLock();
+
+    // With several event queues the producer calling this and the
+    // consumer popping messages run on different threads. The lock keeps
+    // the state consistent, but whether a pop at the same tick has
+    // already updated m_time_last_time_pop and m_size_at_cycle_start
+    // depends on thread scheduling, so the answer is not deterministic.
+
     // determine the correct size for the current cycle
     // pop operations shouldn't effect the network's visible size
     // until schd cycle, but enqueue operations effect the visible
@@ -106,7 +118,7 @@ MessageBuffer::areNSlotsAvailable(unsigned int n, Tick current_time)
 
     if (m_time_last_time_pop < current_time) {
         // no pops this cycle - heap and stall queue size is correct
-        current_size = m_prio_heap.size();
+        current_size = m_num_msgs;
         current_stall_size = m_stall_map_size;
     } else {
         if (m_time_last_time_enqueue < current_time) {
@@ -129,7 +141,7 @@ MessageBuffer::areNSlotsAvailable(unsigned int n, Tick current_time)
         DPRINTF(RubyQueue, "n: %d, current_size: %d, heap size: %d, "
                 "m_max_size: %d\n",
                 n, current_size + current_stall_size,
-                m_prio_heap.size(), m_max_size);
+                m_num_msgs, m_max_size);
         m_not_avail_count++;
         return false;
     }
@@ -138,8 +150,9 @@ MessageBuffer::areNSlotsAvailable(unsigned int n, Tick current_time)
 const Message*
 MessageBuffer::peek() const
 {
+    auto lock = parallelLock();
     DPRINTF(RubyQueue, "Peeking at head of queue.\n");
-    const Message* msg_ptr = m_prio_heap.front().get();
+    const Message* msg_ptr = frontMsg().get();
     assert(msg_ptr);
 
     DPRINTF(RubyQueue, "Message: %s\n", (*msg_ptr));
@@ -150,6 +163,12 @@ MessageBuffer::peek() const
 Tick
 random_time()
 {
+    // The generator is shared by all event queues
+    static std::mutex random_mutex;
+    std::unique_lock<std::mutex> lock(random_mutex, std::defer_lock);
+    if (inParallelMode)
+        lock.lock();
+
     Tick time = 1;
     time += random_mt.random(0, 3);  // [0...3]
     if (random_mt.random(0, 7) == 0) {  // 1 in 8 chance
@@ -161,6 +180,8 @@ random_time()
 void
 MessageBuffer::enqueue(MsgPtr message, Tick current_time, Tick delta)
 {
+    auto lock = parallelLock();
+
     // record current time incase we have a pop that also adjusts my size
     if (m_time_last_time_enqueue < current_time) {
         m_msgs_this_cycle = 0;  // first msg this cycle
@@ -219,9 +240,8 @@ MessageBuffer::enqueue(MsgPtr message, Tick current_time, Tick delta)
     msg_ptr->setLastEnqueueTime(arrival_time);
     msg_ptr->setMsgCounter(m_msg_counter);
 
-    // Insert the message into the priority heap
-    m_prio_heap.push_back(message);
-    push_heap(m_prio_heap.begin(), m_prio_heap.end(), greater<MsgPtr>());
+    // Insert the message into the queue
+    pushMsg(message);
     // Increment the number of messages statistic
     m_buf_msgs++;
 
@@ -230,18 +250,31 @@ MessageBuffer::enqueue(MsgPtr message, Tick current_time, Tick delta)
 
     // Schedule the wakeup
     assert(m_consumer != NULL);
-    m_consumer->scheduleEventAbsolute(arrival_time);
-    m_consumer->storeEventInfo(m_vnet_id);
+    if (m_consumer->isRemote()) {
+        // The consumer runs on another event queue, so let its own
+        // thread schedule the wakeup and record the event info
+        Consumer *consumer = m_consumer;
+        const int vnet = m_vnet_id;
+        m_consumer->scheduleHandoff(arrival_time,
+            [consumer, arrival_time, vnet]{
+                consumer->scheduleEventAbsolute(arrival_time);
+                consumer->storeEventInfo(vnet);
+            });
+    } else {
+        m_consumer->scheduleEventAbsolute(arrival_time);
+        m_consumer->storeEventInfo(m_vnet_id);
+    }
 }
 
 Tick
 MessageBuffer::dequeue(Tick current_time, bool decrement_messages)
 {
+    auto lock = parallelLock();
     DPRINTF(RubyQueue, "Popping\n");
     assert(isReady(current_time));
 
     // get MsgPtr of the message about to be dequeued
-    MsgPtr message = m_prio_heap.front();
+    MsgPtr message = frontMsg();
 
     // get the delay cycles
     message->updateDelayedTicks(current_time);
@@ -252,13 +285,12 @@ MessageBuffer::dequeue(Tick current_time, bool decrement_messages)
     // record previous size and time so the current buffer size isn't
     // adjusted until schd cycle
     if (m_time_last_time_pop < current_time) {
-        m_size_at_cycle_start = m_prio_heap.size();
+        m_size_at_cycle_start = m_num_msgs;
         m_stalled_at_cycle_start = m_stall_map_size;
         m_time_last_time_pop = current_time;
     }
 
-    pop_heap(m_prio_heap.begin(), m_prio_heap.end(), greater<MsgPtr>());
-    m_prio_heap.pop_back();
+    popMsg();
     if (decrement_messages) {
         // If the message will be removed from the queue, decrement the
         // number of message in the queue.
@@ -267,7 +299,18 @@ MessageBuffer::dequeue(Tick current_time, bool decrement_messages)
 
     // if a dequeue callback was requested, call it now
     if (m_dequeue_callback) {
-        m_dequeue_callback();
+        if (inParallelMode && m_dequeue_callback_queue &&
+            m_dequeue_callback_queue != curEventQueue()) {
+            // Run the callback on the thread that registered it. Another
+            // queue may be up to a quantum behind, so the callback has to
+            // be delayed by a full quantum. This makes the callback fire
+            // later than in a single-queue run.
+            auto *evt = new EventFunctionWrapper(m_dequeue_callback,
+                "MessageBuffer Dequeue Callback Event", true);
+            m_dequeue_callback_queue->schedule(evt, curTick() + simQuantum);
+        } else {
+            m_dequeue_callback();
+        }
     }
 
     return delay;
@@ -276,19 +319,33 @@ MessageBuffer::dequeue(Tick current_time, bool decrement_messages)
 void
 MessageBuffer::registerDequeueCallback(std::function<void()> callback)
 {
+    auto lock = parallelLock();
     m_dequeue_callback = callback;
+    m_dequeue_callback_queue = curEventQueue();
 }
 
 void
 MessageBuffer::unregisterDequeueCallback()
 {
+    auto lock = parallelLock();
     m_dequeue_callback = nullptr;
+    m_dequeue_callback_queue = nullptr;
 }
 
 void
 MessageBuffer::clear()
 {
+    auto lock = parallelLock();
+    while (!m_buckets.empty()) {
+        m_buckets.front().msgs.clear();
+        if (m_spare_bucket_msgs.size() < MaxArrivalBuckets) {
+            m_spare_bucket_msgs.push_back(
+                std::move(m_buckets.front().msgs));
+        }
+        m_buckets.pop_front();
+    }
     m_prio_heap.clear();
+    m_num_msgs = 0;
 
     m_msg_counter = 0;
     m_time_last_time_enqueue = 0;
@@ -301,44 +358,127 @@ MessageBuffer::clear()
 void
 MessageBuffer::recycle(Tick current_time, Tick recycle_latency)
 {
+    auto lock = parallelLock();
     DPRINTF(RubyQueue, "Recycling.\n");
     assert(isReady(current_time));
-    MsgPtr node = m_prio_heap.front();
-    pop_heap(m_prio_heap.begin(), m_prio_heap.end(), greater<MsgPtr>());
+    MsgPtr node = frontMsg();
+    popMsg();
 
     Tick future_time = current_time + recycle_latency;
     node->setLastEnqueueTime(future_time);
 
-    m_prio_heap.back() = node;
-    push_heap(m_prio_heap.begin(), m_prio_heap.end(), greater<MsgPtr>());
+    pushMsg(node);
     m_consumer->scheduleEventAbsolute(future_time);
 }
 
 void
-MessageBuffer::reanalyzeList(list<MsgPtr> &lt, Tick schdTick)
+MessageBuffer::pushMsg(const MsgPtr &msg)
 {
-    while (!lt.empty()) {
-        MsgPtr m = lt.front();
-        assert(m->getLastEnqueueTime() <= schdTick);
+    const Tick when = msg->getLastEnqueueTime();
 
-        m_prio_heap.push_back(m);
+    // Arrival times mostly grow, so look for the bucket from the back
+    auto it = m_buckets.end();
+    while (it != m_buckets.begin() && std::prev(it)->when > when) {
+        --it;
+    }
+
+    if (it != m_buckets.begin() && std::prev(it)->when == when) {
+        // Recycled and reanalyzed messages keep their counter, so they
+        // may have to move ahead of younger messages of the bucket
+        std::vector<MsgPtr> &msgs = std::prev(it)->msgs;
+        size_t pos = msgs.size();
+        msgs.push_back(msg);
+        while (pos > std::prev(it)->head &&
+               msgs[pos - 1]->getMsgCounter() > msg->getMsgCounter()) {
+            std::swap(msgs[pos - 1], msgs[pos]);
+            pos--;
+        }
+    } else if (m_buckets.size() < MaxArrivalBuckets) {
+        it = m_buckets.emplace(it);
+        it->when = when;
+        it->head = 0;
+        if (!m_spare_bucket_msgs.empty()) {
+            it->msgs = std::move(m_spare_bucket_msgs.back());
+            m_spare_bucket_msgs.pop_back();
+        }
+        it->msgs.push_back(msg);
+    } else {
+        m_prio_heap.push_back(msg);
         push_heap(m_prio_heap.begin(), m_prio_heap.end(),
                   greater<MsgPtr>());
+    }
+    m_num_msgs++;
+}
+
+void
+MessageBuffer::popMsg()
+{
+    assert(m_num_msgs > 0);
+    if (frontInBucket()) {
+        ArrivalBucket &bucket = m_buckets.front();
+        bucket.msgs[bucket.head].reset();
+        if (++bucket.head == bucket.msgs.size()) {
+            // Retire the bucket, but keep its storage around
+            bucket.msgs.clear();
+            if (m_spare_bucket_msgs.size() < MaxArrivalBuckets) {
+                m_spare_bucket_msgs.push_back(std::move(bucket.msgs));
+            }
+            m_buckets.pop_front();
+        }
+    } else {
+        pop_heap(m_prio_heap.begin(), m_prio_heap.end(), greater<MsgPtr>());
+        m_prio_heap.pop_back();
+    }
+    m_num_msgs--;
+}
+
+int
+MessageBuffer::allocStallNode(const MsgPtr &msg)
+{
+    int idx = m_free_stall_node;
+    if (idx >= 0) {
+        m_free_stall_node = m_stall_nodes[idx].next;
+        m_stall_nodes[idx].msg = msg;
+    } else {
+        idx = m_stall_nodes.size();
+        m_stall_nodes.push_back(StallNode{msg, -1});
+    }
+    m_stall_nodes[idx].next = -1;
+    return idx;
+}
+
+void
+MessageBuffer::reanalyzeList(StallList &lt, Tick schdTick)
+{
+    while (lt.head >= 0) {
+        StallNode &node = m_stall_nodes[lt.head];
+        MsgPtr m = std::move(node.msg);
+        assert(m->getLastEnqueueTime() <= schdTick);
+
+        pushMsg(m);
 
         m_consumer->scheduleEventAbsolute(schdTick);
 
         DPRINTF(RubyQueue, "Requeue arrival_time: %lld, Message: %s\n",
             schdTick, *(m.get()));
 
-        lt.pop_front();
+        // Return the node to the free list
+        const int next = node.next;
+        node.next = m_free_stall_node;
+        m_free_stall_node = lt.head;
+        lt.head = next;
     }
+    lt.tail = -1;
+    lt.size = 0;
 }
 
 void
 MessageBuffer::reanalyzeMessages(Addr addr, Tick current_time)
 {
+    auto lock = parallelLock();
     DPRINTF(RubyQueue, "ReanalyzeMessages %#x\n", addr);
-    assert(m_stall_msg_map.count(addr) > 0);
+    auto it = m_stall_msg_map.find(addr);
+    assert(it != m_stall_msg_map.end());
 
     //
     // Put all stalled messages associated with this address back on the
@@ -346,15 +486,16 @@ MessageBuffer::reanalyzeMessages(Addr addr, Tick current_time)
     // scheduled for the current cycle so that the previously stalled messages
     // will be observed before any younger messages that may arrive this cycle
     //
-    m_stall_map_size -= m_stall_msg_map[addr].size();
+    m_stall_map_size -= it->second.size;
     assert(m_stall_map_size >= 0);
-    reanalyzeList(m_stall_msg_map[addr], current_time);
-    m_stall_msg_map.erase(addr);
+    reanalyzeList(it->second, current_time);
+    m_stall_msg_map.erase(it);
 }
 
 void
 MessageBuffer::reanalyzeAllMessages(Tick current_time)
 {
+    auto lock = parallelLock();
     DPRINTF(RubyQueue, "ReanalyzeAllMessages\n");
 
     //
@@ -365,7 +506,7 @@ MessageBuffer::reanalyzeAllMessages(Tick current_time)
     //
     for (StallMsgMapType::iterator map_iter = m_stall_msg_map.begin();
          map_iter != m_stall_msg_map.end(); ++map_iter) {
-        m_stall_map_size -= map_iter->second.size();
+        m_stall_map_size -= map_iter->second.size;
         assert(m_stall_map_size >= 0);
         reanalyzeList(map_iter->second, current_time);
     }
@@ -375,10 +516,11 @@ MessageBuffer::reanalyzeAllMessages(Tick current_time)
 void
 MessageBuffer::stallMessage(Addr addr, Tick current_time)
 {
+    auto lock = parallelLock();
     DPRINTF(RubyQueue, "Stalling due to %#x\n", addr);
     assert(isReady(current_time));
     assert(getOffset(addr) == 0);
-    MsgPtr message = m_prio_heap.front();
+    MsgPtr message = frontMsg();
 
     // Since the message will just be moved to stall map, indicate that the
     // buffer should not decrement the m_buf_msgs statistic
@@ -389,7 +531,15 @@ MessageBuffer::stallMessage(Addr addr, Tick current_time)
     // Instead the controller is responsible to call reanalyzeMessages when
     // these addresses change state.
     //
-    (m_stall_msg_map[addr]).push_back(message);
+    StallList &lt = m_stall_msg_map[addr];
+    const int idx = allocStallNode(message);
+    if (lt.tail >= 0) {
+        m_stall_nodes[lt.tail].next = idx;
+    } else {
+        lt.head = idx;
+    }
+    lt.tail = idx;
+    lt.size++;
     m_stall_map_size++;
     m_stall_count++;
 }
@@ -397,6 +547,7 @@ MessageBuffer::stallMessage(Addr addr, Tick current_time)
 bool
 MessageBuffer::hasStalledMsg(Addr addr) const
 {
+    auto lock = parallelLock();
     return (m_stall_msg_map.count(addr) != 0);
 }
 
@@ -433,21 +584,25 @@ MessageBuffer::isDeferredMsgMapEmpty(Addr addr) const
 void
 MessageBuffer::print(ostream& out) const
 {
+    auto lock = parallelLock();
     ccprintf(out, "[MessageBuffer: ");
     if (m_consumer != NULL) {
         ccprintf(out, " consumer-yes ");
     }
 
-    vector<MsgPtr> copy(m_prio_heap);
-    sort_heap(copy.begin(), copy.end(), greater<MsgPtr>());
+    vector<MsgPtr> copy;
+    copy.reserve(m_num_msgs);
+    forEachMsg([&copy](const MsgPtr &msg) { copy.push_back(msg); });
+    sort(copy.begin(), copy.end(), greater<MsgPtr>());
     ccprintf(out, "%s] %s", copy, name());
 }
 
 bool
 MessageBuffer::isReady(Tick current_time) const
 {
-    return ((m_prio_heap.size() > 0) &&
-        (m_prio_heap.front()->getLastEnqueueTime() <= current_time));
+    auto lock = parallelLock();
+    return ((m_num_msgs > 0) &&
+        (frontMsg()->getLastEnqueueTime() <= current_time));
 }
 
 void
@@ -491,10 +646,21 @@ MessageBuffer::functionalAccess(Packet *pkt, bool is_read)
     DPRINTF(RubyQueue, "functional %s for %#x\n",
             is_read ? "read" : "write", pkt->getAddr());
 
+    auto lock = parallelLock();
     uint32_t num_functional_accesses = 0;
 
-    // Check the priority heap and write any messages that may
-    // correspond to the address in the packet.
+    // Check the queue and write any messages that may correspond to the
+    // address in the packet.
+    for (const auto &bucket : m_buckets) {
+        for (size_t i = bucket.head; i < bucket.msgs.size(); ++i) {
+            Message *msg = bucket.msgs[i].get();
+            if (is_read && msg->functionalRead(pkt))
+                return 1;
+            else if (!is_read && msg->functionalWrite(pkt))
+                num_functional_accesses++;
+        }
+    }
+
     for (unsigned int i = 0; i < m_prio_heap.size(); ++i) {
         Message *msg = m_prio_heap[i].get();
         if (is_read && msg->functionalRead(pkt))
@@ -509,10 +675,10 @@ MessageBuffer::functionalAccess(Packet *pkt, bool is_read)
          map_iter != m_stall_msg_map.end();
          ++map_iter) {
 
-        for (std::list<MsgPtr>::iterator it = (map_iter->second).begin();
-            it != (map_iter->second).end(); ++it) {
+        for (int idx = map_iter->second.head; idx >= 0;
+             idx = m_stall_nodes[idx].next) {
 
-            Message *msg = (*it).get();
+            Message *msg = m_stall_nodes[idx].msg.get();
             if (is_read && msg->functionalRead(pkt))
                 return 1;
             else if (!is_read && msg->functionalWrite(pkt))
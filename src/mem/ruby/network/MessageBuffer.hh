@@ -48,12 +48,15 @@
 
 #include <algorithm>
 #include <cassert>
+#include <deque>
 #include <functional>
 #include <iostream>
+#include <mutex>
 #include <string>
 #include <unordered_map>
 #include <vector>
 
+#include "base/open_hash_map.hh"
 #include "base/trace.hh"
 #include "debug/RubyQueue.hh"
 #include "mem/packet.hh"
@@ -83,10 +86,9 @@ class MessageBuffer : public SimObject
     void
     delayHead(Tick current_time, Tick delta)
     {
-        MsgPtr m = m_prio_heap.front();
-        std::pop_heap(m_prio_heap.begin(), m_prio_heap.end(),
-                      std::greater<MsgPtr>());
-        m_prio_heap.pop_back();
+        auto lock = parallelLock();
+        MsgPtr m = frontMsg();
+        popMsg();
         enqueue(m, current_time, delta);
     }
 
@@ -112,7 +114,7 @@ class MessageBuffer : public SimObject
     //! message queue.  The function assumes that the queue is nonempty.
     const Message* peek() const;
 
-    const MsgPtr &peekMsgPtr() const { return m_prio_heap.front(); }
+    const MsgPtr &peekMsgPtr() const { return frontMsg(); }
 
     void enqueue(MsgPtr message, Tick curTime, Tick delta);
 
@@ -132,13 +134,31 @@ class MessageBuffer : public SimObject
     //! removes it from the queue and returns its total delay.
     Tick dequeue(Tick current_time, bool decrement_messages = true);
 
+    // The callback runs on the event queue that registered it. When the
+    // buffer is dequeued from another queue, it runs one simulation
+    // quantum after the dequeue.
     void registerDequeueCallback(std::function<void()> callback);
     void unregisterDequeueCallback();
 
     void recycle(Tick current_time, Tick recycle_latency);
-    bool isEmpty() const { return m_prio_heap.size() == 0; }
-    bool isStallMapEmpty() { return m_stall_msg_map.size() == 0; }
-    unsigned int getStallMapSize() { return m_stall_msg_map.size(); }
+    bool
+    isEmpty() const
+    {
+        auto lock = parallelLock();
+        return m_num_msgs == 0;
+    }
+    bool
+    isStallMapEmpty()
+    {
+        auto lock = parallelLock();
+        return m_stall_msg_map.empty();
+    }
+    unsigned int
+    getStallMapSize()
+    {
+        auto lock = parallelLock();
+        return m_stall_msg_map.size();
+    }
 
     unsigned int getSize(Tick curTime);
 
@@ -175,7 +195,99 @@ class MessageBuffer : public SimObject
     }
 
   private:
-    void reanalyzeList(std::list<MsgPtr> &, Tick);
+    typedef std::unique_lock<std::recursive_mutex> ParallelLock;
+
+    /**
+     * Lock the buffer if the simulation runs on several event queues.
+     * The producer and the consumer of a buffer may then live on
+     * different threads, and both of them update the queue state.
+     */
+    ParallelLock
+    parallelLock() const
+    {
+        if (inParallelMode)
+            return ParallelLock(m_mutex);
+        return ParallelLock(m_mutex, std::defer_lock);
+    }
+
+    /**
+     * A list of messages stalled on the same address. The messages are
+     * linked through the nodes of m_stall_nodes, so stalling and
+     * reanalyzing messages does not allocate once the pool is warm.
+     */
+    struct StallList
+    {
+        int head = -1;
+        int tail = -1;
+        unsigned size = 0;
+    };
+
+    struct StallNode
+    {
+        MsgPtr msg;
+        int next;
+    };
+
+    void reanalyzeList(StallList &, Tick);
+
+    /** Take a node from the stall pool and fill it with a message. */
+    int allocStallNode(const MsgPtr &msg);
+
+    /**
+     * A set of messages that arrive at the same tick, ordered by their
+     * message counters. Messages before head have been dequeued already.
+     */
+    struct ArrivalBucket
+    {
+        Tick when;
+        std::vector<MsgPtr> msgs;
+        size_t head;
+    };
+
+    /** Maximum number of distinct arrival ticks kept in buckets. */
+    static const unsigned MaxArrivalBuckets = 16;
+
+    /** Insert a message in the queue, keyed by its last enqueue time. */
+    void pushMsg(const MsgPtr &msg);
+
+    /** Check if the oldest message is at the head of the first bucket. */
+    bool
+    frontInBucket() const
+    {
+        if (m_buckets.empty())
+            return false;
+        const ArrivalBucket &bucket = m_buckets.front();
+        return m_prio_heap.empty() ||
+            m_prio_heap.front() > bucket.msgs[bucket.head];
+    }
+
+    /** Get the oldest message of the queue, which must not be empty. */
+    const MsgPtr &
+    frontMsg() const
+    {
+        assert(m_num_msgs > 0);
+        if (frontInBucket()) {
+            const ArrivalBucket &bucket = m_buckets.front();
+            return bucket.msgs[bucket.head];
+        }
+        return m_prio_heap.front();
+    }
+
+    /** Remove the oldest message of the queue. */
+    void popMsg();
+
+    /** Call a function on every queued message, in no particular order. */
+    template <class F>
+    void
+    forEachMsg(F f) const
+    {
+        for (const auto &bucket : m_buckets) {
+            for (size_t i = bucket.head; i < bucket.msgs.size(); i++)
+                f(bucket.msgs[i]);
+        }
+        for (const auto &msg : m_prio_heap)
+            f(msg);
+    }
 
     uint32_t functionalAccess(Packet *pkt, bool is_read);
 
@@ -183,29 +295,54 @@ class MessageBuffer : public SimObject
     // Data Members (m_ prefix)
     //! Consumer to signal a wakeup(), can be NULL
     Consumer* m_consumer;
+
+    /**
+     * Queued messages. Messages arrive with a handful of distinct
+     * latencies, so most of them go in a short list of per-tick FIFO
+     * buckets, sorted by arrival tick. A message arriving at a new tick
+     * when all buckets are in use goes in a binary heap instead. The
+     * oldest message is at the head of either the first bucket or the
+     * heap.
+     */
+    std::deque<ArrivalBucket> m_buckets;
     std::vector<MsgPtr> m_prio_heap;
+    //! Storage of retired buckets, kept to be reused by new ones
+    std::vector<std::vector<MsgPtr>> m_spare_bucket_msgs;
+    //! Number of messages in the buckets and the heap
+    unsigned int m_num_msgs;
 
     std::function<void()> m_dequeue_callback;
+    //! Event queue the dequeue callback was registered from
+    EventQueue *m_dequeue_callback_queue;
 
-    // use a std::map for the stalled messages as this container is
-    // sorted and ensures a well-defined iteration order
-    typedef std::map<Addr, std::list<MsgPtr> > StallMsgMapType;
+    mutable std::recursive_mutex m_mutex;
+
+    // the iteration order of the table depends on the history of
+    // insertions, erasures and growth. Nothing relies on it: reanalyzed
+    // messages are put back in order by their counters, and functional
+    // accesses only match the list of the packet's line
+    typedef OpenHashMap<Addr, StallList> StallMsgMapType;
 
     /**
      * A map from line addresses to lists of stalled messages for that line.
      * If this buffer allows the receiver to stall messages, on a stall
-     * request, the stalled message is removed from the m_prio_heap and placed
+     * request, the stalled message is removed from the queue and placed
      * in the m_stall_msg_map. Messages are held there until the receiver
      * requests they be reanalyzed, at which point they are moved back to
-     * m_prio_heap.
+     * the queue.
      *
      * NOTE: The stall map holds messages in the order in which they were
      * initially received, and when a line is unblocked, the messages are
-     * moved back to the m_prio_heap in the same order. This prevents starving
+     * moved back to the queue in the same order. This prevents starving
      * older requests with younger ones.
      */
     StallMsgMapType m_stall_msg_map;
 
+    //! Pool of the nodes of the stall lists
+    std::vector<StallNode> m_stall_nodes;
+    //! Head of the list of free nodes in m_stall_nodes
+    int m_free_stall_node;
+
     /**
      * A map from line addresses to corresponding vectors of messages that
      * are deferred for enqueueing. Messages in this map are waiting to be
@@ -218,7 +355,7 @@ class MessageBuffer : public SimObject
      * Current size of the stall map.
      * Track the number of messages held in stall map lists. This is used to
      * ensure that if the buffer is finite-sized, it blocks further requests
-     * when the m_prio_heap and m_stall_msg_map contain m_max_size messages.
+     * when the queue and m_stall_msg_map contain m_max_size messages.
      */
     int m_stall_map_size;
 
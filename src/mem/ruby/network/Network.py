@@ -42,6 +42,8 @@ class RubyNetwork(ClockedObject):
            "the number of virtual networks should be one more than the "
            "highest numbered vnet in use.")
     control_msg_size = Param.Int(8, "")
+    routing_threads = Param.Unsigned(1, "Number of host threads used to "
+           "compute the routing tables at startup")
     ruby_system = Param.RubySystem("")
 
     routers = VectorParam.BasicRouter("Network routers")
@@ -29,7 +29,12 @@
 
 #include "mem/ruby/network/Topology.hh"
 
+#include <algorithm>
+#include <atomic>
 #include <cassert>
+#include <functional>
+#include <queue>
+#include <thread>
 
 #include "base/trace.hh"
 #include "debug/RubyNetwork.hh"
@@ -52,9 +57,11 @@ const int INFINITE_LATENCY = 10000; // Yes, this is a big hack
 Topology::Topology(uint32_t num_nodes, uint32_t num_routers,
                    uint32_t num_vnets,
                    const vector<BasicExtLink *> &ext_links,
-                   const vector<BasicIntLink *> &int_links)
+                   const vector<BasicIntLink *> &int_links,
+                   unsigned num_threads)
     : m_nodes(MachineType_base_number(MachineType_NUM)),
       m_number_of_switches(num_routers), m_vnets(num_vnets),
+      m_num_threads(std::max(num_threads, 1u)),
       m_ext_link_vector(ext_links), m_int_link_vector(int_links)
 {
     // Total nodes/controllers in network
@@ -119,29 +126,20 @@ Topology::createLinks(Network *net)
         max_switch_id = max(max_switch_id, src_dest.second);
     }
 
-    // Initialize weight, latency, and inter switched vectors
+    // Only the configured links are stored: a weight per vnet for each
+    // source and destination pair, and for each vnet the reversed
+    // adjacency list used by the shortest path search.
     int num_switches = max_switch_id+1;
-    Matrix topology_weights(m_vnets,
-            vector<vector<int>>(num_switches,
-            vector<int>(num_switches, INFINITE_LATENCY)));
-    Matrix component_latencies(num_switches,
-            vector<vector<int>>(num_switches,
-            vector<int>(m_vnets, -1)));
-    Matrix component_inter_switches(num_switches,
-            vector<vector<int>>(num_switches,
-            vector<int>(m_vnets, 0)));
-
-    // Set identity weights to zero
-    for (int i = 0; i < topology_weights[0].size(); i++) {
-        for (int v = 0; v < m_vnets; v++) {
-            topology_weights[v][i][i] = 0;
-        }
-    }
+    std::map<std::pair<SwitchID, SwitchID>, vector<int>> link_weights;
+    vector<AdjacencyList> reverse_links(m_vnets,
+                                        AdjacencyList(num_switches));
 
     // Fill in the topology weights and bandwidth multipliers
     for (auto link_group : m_link_map) {
         std::pair<int, int> src_dest = link_group.first;
         vector<bool> vnet_done(m_vnets, 0);
+        vector<int> &weights = link_weights[src_dest];
+        weights.assign(m_vnets, INFINITE_LATENCY);
         int src = src_dest.first;
         int dst = src_dest.second;
 
@@ -156,8 +154,7 @@ Topology::createLinks(Network *net)
                     fatal_if(vnet_done[v], "Two links connecting same src"
                     " and destination cannot support same vnets");
 
-                    component_latencies[src][dst][v] = link->m_latency;
-                    topology_weights[v][src][dst] = link->m_weight;
+                    weights[v] = link->m_weight;
                     vnet_done[v] = true;
                 }
             } else {
@@ -170,43 +167,46 @@ Topology::createLinks(Network *net)
                     fatal_if(vnet_done[vnet], "Two links connecting same src"
                     " and destination cannot support same vnets");
 
-                    component_latencies[src][dst][vnet] = link->m_latency;
-                    topology_weights[vnet][src][dst] = link->m_weight;
+                    weights[vnet] = link->m_weight;
                     vnet_done[vnet] = true;
                 }
             }
         }
+
+        for (int v = 0; v < m_vnets; v++) {
+            if (weights[v] != INFINITE_LATENCY)
+                reverse_links[v][dst].emplace_back(src, weights[v]);
+        }
     }
 
     // Walk topology and hookup the links
-    Matrix dist = shortest_path(topology_weights, component_latencies,
-                                component_inter_switches);
-
-    for (int i = 0; i < topology_weights[0].size(); i++) {
-        for (int j = 0; j < topology_weights[0][i].size(); j++) {
-            std::vector<NetDest> routingMap;
-            routingMap.resize(m_vnets);
-
-            // Not all sources and destinations are connected
-            // by direct links. We only construct the links
-            // which have been configured in topology.
-            bool realLink = false;
-
-            for (int v = 0; v < m_vnets; v++) {
-                int weight = topology_weights[v][i][j];
-                if (weight > 0 && weight != INFINITE_LATENCY) {
-                    realLink = true;
-                    routingMap[v] =
-                        shortest_path_to_node(i, j, topology_weights, dist, v);
-                }
-            }
-            // Make one link for each set of vnets between
-            // a given source and destination. We do not
-            // want to create one link for each vnet.
-            if (realLink) {
-                makeLink(net, i, j, routingMap);
+    Matrix dist = shortest_path(reverse_links);
+
+    for (const auto &link_weight : link_weights) {
+        SwitchID i = link_weight.first.first;
+        SwitchID j = link_weight.first.second;
+        const vector<int> &weights = link_weight.second;
+        std::vector<NetDest> routingMap;
+        routingMap.resize(m_vnets);
+
+        // A source and destination pair may be configured without
+        // carrying any vnet, in which case no link is made.
+        bool realLink = false;
+
+        for (int v = 0; v < m_vnets; v++) {
+            int weight = weights[v];
+            if (weight > 0 && weight != INFINITE_LATENCY) {
+                realLink = true;
+                routingMap[v] =
+                    shortest_path_to_node(i, j, weight, dist, v);
             }
         }
+        // Make one link for each set of vnets between
+        // a given source and destination. We do not
+        // want to create one link for each vnet.
+        if (realLink) {
+            makeLink(net, i, j, routingMap);
+        }
     }
 }
 
@@ -326,106 +326,92 @@ Topology::makeLink(Network *net, SwitchID src, SwitchID dest,
     }
 }
 
-// The following all-pairs shortest path algorithm is based on the
-// discussion from Cormen et al., Chapter 26.1.
 void
-Topology::extend_shortest_path(Matrix &current_dist, Matrix &latencies,
-    Matrix &inter_switches)
+Topology::shortest_path_to_dest(const AdjacencyList &reverse_links,
+                                SwitchID dest, vector<int> &dist)
 {
-    int nodes = current_dist[0].size();
-
-    // We find the shortest path for each vnet for a given pair of
-    // source and destinations. This is done simply by traversing via
-    // all other nodes and finding the minimum distance.
-    for (int v = 0; v < m_vnets; v++) {
-        // There is a different topology for each vnet. Here we try to
-        // build a topology by finding the minimum number of intermediate
-        // switches needed to reach the destination
-        bool change = true;
-        while (change) {
-            change = false;
-            for (int i = 0; i < nodes; i++) {
-                for (int j = 0; j < nodes; j++) {
-                    // We follow an iterative process to build the shortest
-                    // path tree:
-                    // 1. Start from the direct connection (if there is one,
-                    // otherwise assume a hypothetical infinite weight link).
-                    // 2. Then we iterate through all other nodes considering
-                    // new potential intermediate switches. If we find any
-                    // lesser weight combination, we set(update) that as the
-                    // new weight between the source and destination.
-                    // 3. Repeat for all pairs of nodes.
-                    // 4. Go to step 1 if there was any new update done in
-                    // Step 2.
-                    int minimum = current_dist[v][i][j];
-                    int previous_minimum = minimum;
-                    int intermediate_switch = -1;
-                    for (int k = 0; k < nodes; k++) {
-                        minimum = min(minimum,
-                            current_dist[v][i][k] + current_dist[v][k][j]);
-                        if (previous_minimum != minimum) {
-                            intermediate_switch = k;
-                            inter_switches[i][j][v] =
-                                inter_switches[i][k][v] +
-                                inter_switches[k][j][v] + 1;
-                        }
-                        previous_minimum = minimum;
-                    }
-                    if (current_dist[v][i][j] != minimum) {
-                        change = true;
-                        current_dist[v][i][j] = minimum;
-                        assert(intermediate_switch >= 0);
-                        assert(intermediate_switch < latencies[i].size());
-                        latencies[i][j][v] =
-                            latencies[i][intermediate_switch][v] +
-                            latencies[intermediate_switch][j][v];
-                    }
-                }
+    typedef std::pair<int, SwitchID> QueueEntry;
+    std::priority_queue<QueueEntry, vector<QueueEntry>,
+                        std::greater<QueueEntry>> queue;
+
+    dist.assign(reverse_links.size(), INFINITE_LATENCY);
+    dist[dest] = 0;
+    queue.emplace(0, dest);
+
+    while (!queue.empty()) {
+        QueueEntry top = queue.top();
+        queue.pop();
+        SwitchID node = top.second;
+        if (top.first > dist[node])
+            continue;
+
+        // Relax every link ending at this switch. Paths as long as
+        // INFINITE_LATENCY are treated as unreachable.
+        for (const auto &link : reverse_links[node]) {
+            int d = top.first + link.second;
+            if (d < dist[link.first] && d < INFINITE_LATENCY) {
+                dist[link.first] = d;
+                queue.emplace(d, link.first);
             }
         }
     }
 }
 
 Matrix
-Topology::shortest_path(const Matrix &weights, Matrix &latencies,
-                        Matrix &inter_switches)
+Topology::shortest_path(const vector<AdjacencyList> &reverse_links)
 {
-    Matrix dist = weights;
-    extend_shortest_path(dist, latencies, inter_switches);
+    // Routing tables only ever ask for the distance to an endpoint
+    // output switch, so a single-destination search from each of
+    // those is enough. The searches are independent and are shared
+    // between the configured number of host threads.
+    Matrix dist(m_vnets, vector<vector<int>>(m_nodes));
+    const int num_searches = m_vnets * m_nodes;
+    std::atomic<int> next_search(0);
+
+    auto worker = [&]() {
+        for (int s = next_search++; s < num_searches; s = next_search++) {
+            int v = s / m_nodes;
+            int d = s % m_nodes;
+            shortest_path_to_dest(reverse_links[v], d + m_nodes, dist[v][d]);
+        }
+    };
+
+    unsigned num_threads = std::min<unsigned>(m_num_threads, num_searches);
+    vector<std::thread> threads;
+    for (unsigned t = 1; t < num_threads; t++)
+        threads.emplace_back(worker);
+    worker();
+    for (auto &thread : threads)
+        thread.join();
+
     return dist;
 }
 
 bool
 Topology::link_is_shortest_path_to_node(SwitchID src, SwitchID next,
-                                        SwitchID final, const Matrix &weights,
+                                        int weight, int final,
                                         const Matrix &dist, int vnet)
 {
-    return weights[vnet][src][next] + dist[vnet][next][final] ==
-        dist[vnet][src][final];
+    return weight + dist[vnet][final][next] == dist[vnet][final][src];
 }
 
 NetDest
-Topology::shortest_path_to_node(SwitchID src, SwitchID next,
-                                const Matrix &weights, const Matrix &dist,
-                                int vnet)
+Topology::shortest_path_to_node(SwitchID src, SwitchID next, int weight,
+                                const Matrix &dist, int vnet)
 {
     NetDest result;
     int d = 0;
     int machines;
-    int max_machines;
 
     machines = MachineType_NUM;
-    max_machines = MachineType_base_number(MachineType_NUM);
 
     for (int m = 0; m < machines; m++) {
         for (NodeID i = 0; i < MachineType_base_count((MachineType)m); i++) {
-            // we use "d+max_machines" below since the "destination"
-            // switches for the machines are numbered
-            // [MachineType_base_number(MachineType_NUM)...
-            //  2*MachineType_base_number(MachineType_NUM)-1] for the
-            // component network
-            if (link_is_shortest_path_to_node(src, next, d + max_machines,
-                    weights, dist, vnet)) {
+            // the distances are indexed by "d" rather than by the
+            // "destination" switch for the machine, which is numbered
+            // d+m_nodes in the component network
+            if (link_is_shortest_path_to_node(src, next, weight, d,
+                    dist, vnet)) {
                 MachineID mach = {(MachineType)m, i};
                 result.add(mach);
             }
@@ -434,9 +420,9 @@ Topology::shortest_path_to_node(SwitchID src, SwitchID next,
     }
 
     DPRINTF(RubyNetwork, "Returning shortest path\n"
-            "(src-(2*max_machines)): %d, (next-(2*max_machines)): %d, "
+            "(src-(2*m_nodes)): %d, (next-(2*m_nodes)): %d, "
             "src: %d, next: %d, vnet:%d result: %s\n",
-            (src-(2*max_machines)), (next-(2*max_machines)),
+            (src-(2*m_nodes)), (next-(2*m_nodes)),
             src, next, vnet, result);
 
     return result;
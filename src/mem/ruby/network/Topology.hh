@@ -43,6 +43,7 @@
 
 #include <iostream>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "mem/ruby/common/TypeDefines.hh"
@@ -61,6 +62,13 @@ class Network;
 typedef std::vector<std::vector<std::vector<int>>> Matrix;
 typedef std::string PortDirection;
 
+/*
+ * Sparse per-vnet view of the topology used by the shortest path
+ * search. Each switch keeps the list of links that end at it, as
+ * (source switch, weight) pairs.
+ */
+typedef std::vector<std::vector<std::pair<SwitchID, int>>> AdjacencyList;
+
 struct LinkEntry
 {
     BasicLink *link;
@@ -76,7 +84,8 @@ class Topology
   public:
     Topology(uint32_t num_nodes, uint32_t num_routers, uint32_t num_vnets,
              const std::vector<BasicExtLink *> &ext_links,
-             const std::vector<BasicIntLink *> &int_links);
+             const std::vector<BasicIntLink *> &int_links,
+             unsigned num_threads = 1);
 
     uint32_t numSwitches() const { return m_number_of_switches; }
     void createLinks(Network *net);
@@ -89,24 +98,28 @@ class Topology
     void makeLink(Network *net, SwitchID src, SwitchID dest,
                   std::vector<NetDest>& routing_table_entry);
 
-    // Helper functions based on chapter 29 of Cormen et al.
-    void extend_shortest_path(Matrix &current_dist, Matrix &latencies,
-                              Matrix &inter_switches);
+    // Single-destination shortest paths (Dijkstra, Cormen et al.
+    // chapter 24.3) run over the reversed links of one vnet.
+    void shortest_path_to_dest(const AdjacencyList &reverse_links,
+                               SwitchID dest, std::vector<int> &dist);
 
-    Matrix shortest_path(const Matrix &weights,
-            Matrix &latencies, Matrix &inter_switches);
+    /**
+     * Compute, for every vnet and every endpoint output switch, the
+     * distance from each switch to that endpoint. The result is
+     * indexed as dist[vnet][endpoint][switch].
+     */
+    Matrix shortest_path(const std::vector<AdjacencyList> &reverse_links);
 
     bool link_is_shortest_path_to_node(SwitchID src, SwitchID next,
-            SwitchID final, const Matrix &weights, const Matrix &dist,
-            int vnet);
+            int weight, int final, const Matrix &dist, int vnet);
 
-    NetDest shortest_path_to_node(SwitchID src, SwitchID next,
-                                  const Matrix &weights, const Matrix &dist,
-                                  int vnet);
+    NetDest shortest_path_to_node(SwitchID src, SwitchID next, int weight,
+                                  const Matrix &dist, int vnet);
 
     const uint32_t m_nodes;
     const uint32_t m_number_of_switches;
     int m_vnets;
+    const unsigned m_num_threads;
 
     std::vector<BasicExtLink*> m_ext_link_vector;
     std::vector<BasicIntLink*> m_int_link_vector;
@@ -59,6 +59,7 @@ GarnetNetwork::GarnetNetwork(const Params *p)
     m_num_rows = p->num_rows;
     m_ni_flit_size = p->ni_flit_size;
     m_max_vcs_per_vnet = 0;
+    m_packets_in_flight = 0;
     m_buffers_per_data_vc = p->buffers_per_data_vc;
     m_buffers_per_ctrl_vc = p->buffers_per_ctrl_vc;
     m_routing_algorithm = p->routing_algorithm;
@@ -567,6 +568,12 @@ GarnetNetwork::functionalWrite(Packet *pkt)
 {
     uint32_t num_functional_writes = 0;
 
+    // Routers, interfaces and links only buffer flits of packets in
+    // flight, so there is nothing to update in a quiescent network
+    if (isQuiescent()) {
+        return num_functional_writes;
+    }
+
     for (unsigned int i = 0; i < m_routers.size(); i++) {
         num_functional_writes += m_routers[i]->functionalWrite(pkt);
     }
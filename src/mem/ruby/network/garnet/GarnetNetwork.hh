@@ -33,6 +33,7 @@
 #define __MEM_RUBY_NETWORK_GARNET_0_GARNETNETWORK_HH__
 
 #include <iostream>
+#include <mutex>
 #include <vector>
 
 #include "mem/ruby/network/Network.hh"
@@ -106,39 +107,72 @@ class GarnetNetwork : public Network
     void print(std::ostream& out) const;
 
     // increment counters
-    void increment_injected_packets(int vnet) { m_packets_injected[vnet]++; }
-    void increment_received_packets(int vnet) { m_packets_received[vnet]++; }
+    void
+    increment_injected_packets(int vnet)
+    {
+        auto lock = statsLock();
+        m_packets_injected[vnet]++;
+        m_packets_in_flight++;
+    }
+
+    void
+    increment_received_packets(int vnet)
+    {
+        auto lock = statsLock();
+        m_packets_received[vnet]++;
+        assert(m_packets_in_flight > 0);
+        m_packets_in_flight--;
+    }
+
+    // The network holds no flits when all injected packets were received
+    bool isQuiescent() const { return m_packets_in_flight == 0; }
 
     void
     increment_packet_network_latency(Tick latency, int vnet)
     {
+        auto lock = statsLock();
         m_packet_network_latency[vnet] += latency;
     }
 
     void
     increment_packet_queueing_latency(Tick latency, int vnet)
     {
+        auto lock = statsLock();
         m_packet_queueing_latency[vnet] += latency;
     }
 
-    void increment_injected_flits(int vnet) { m_flits_injected[vnet]++; }
-    void increment_received_flits(int vnet) { m_flits_received[vnet]++; }
+    void
+    increment_injected_flits(int vnet)
+    {
+        auto lock = statsLock();
+        m_flits_injected[vnet]++;
+    }
+
+    void
+    increment_received_flits(int vnet)
+    {
+        auto lock = statsLock();
+        m_flits_received[vnet]++;
+    }
 
     void
     increment_flit_network_latency(Tick latency, int vnet)
     {
+        auto lock = statsLock();
         m_flit_network_latency[vnet] += latency;
     }
 
     void
     increment_flit_queueing_latency(Tick latency, int vnet)
     {
+        auto lock = statsLock();
         m_flit_queueing_latency[vnet] += latency;
     }
 
     void
     increment_total_hops(int hops)
     {
+        auto lock = statsLock();
         m_total_hops += hops;
     }
 
@@ -186,6 +220,24 @@ class GarnetNetwork : public Network
     Stats::Formula m_avg_hops;
 
   private:
+    /**
+     * The network wide counters are updated by the interfaces and
+     * routers, which may run on several event queues.
+     */
+    std::unique_lock<std::mutex>
+    statsLock()
+    {
+        if (inParallelMode)
+            return std::unique_lock<std::mutex>(m_stats_mutex);
+        return std::unique_lock<std::mutex>(m_stats_mutex, std::defer_lock);
+    }
+
+    std::mutex m_stats_mutex;
+
+    // Number of packets injected but not received yet. Unlike the
+    // packet stats, it is not cleared by a stats reset.
+    uint64_t m_packets_in_flight;
+
     GarnetNetwork(const GarnetNetwork& obj);
     GarnetNetwork& operator=(const GarnetNetwork& obj);
 
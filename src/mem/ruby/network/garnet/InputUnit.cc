@@ -31,6 +31,7 @@
 
 #include "mem/ruby/network/garnet/InputUnit.hh"
 
+#include "base/bitfield.hh"
 #include "debug/RubyNetwork.hh"
 #include "mem/ruby/network/garnet/Credit.hh"
 #include "mem/ruby/network/garnet/Router.hh"
@@ -39,7 +40,7 @@ using namespace std;
 
 InputUnit::InputUnit(int id, PortDirection direction, Router *router)
   : Consumer(router), m_router(router), m_id(id), m_direction(direction),
-    m_vc_per_vnet(m_router->get_vc_per_vnet())
+    m_vc_per_vnet(m_router->get_vc_per_vnet()), m_num_occupied_vcs(0)
 {
     const int m_num_vcs = m_router->get_num_vcs();
     m_num_buffer_reads.resize(m_num_vcs/m_vc_per_vnet);
@@ -54,6 +55,7 @@ InputUnit::InputUnit(int id, PortDirection direction, Router *router)
     for (int i=0; i < m_num_vcs; i++) {
         virtualChannels.emplace_back();
     }
+    m_occupied_vcs.resize((m_num_vcs + 63) / 64, 0);
 }
 
 /*
@@ -102,6 +104,7 @@ InputUnit::wakeup()
 
         // Buffer the flit
         virtualChannels[vc].insertFlit(t_flit);
+        set_vc_occupied(vc);
 
         int vnet = vc/m_vc_per_vnet;
         // number of writes same as reads
@@ -132,6 +135,47 @@ InputUnit::wakeup()
     }
 }
 
+void
+InputUnit::set_vc_occupied(int vc)
+{
+    uint64_t &word = m_occupied_vcs[vc / 64];
+    const uint64_t bit = 1ULL << (vc % 64);
+    if (!(word & bit)) {
+        word |= bit;
+        m_num_occupied_vcs++;
+        m_router->vc_occupied();
+    }
+}
+
+void
+InputUnit::clear_vc_occupied(int vc)
+{
+    uint64_t &word = m_occupied_vcs[vc / 64];
+    const uint64_t bit = 1ULL << (vc % 64);
+    if (word & bit) {
+        word &= ~bit;
+        m_num_occupied_vcs--;
+        m_router->vc_freed();
+    }
+}
+
+int
+InputUnit::next_occupied_vc(int vc) const
+{
+    const int num_vcs = virtualChannels.size();
+    if (vc >= num_vcs)
+        return -1;
+
+    int idx = vc / 64;
+    uint64_t word = m_occupied_vcs[idx] & (~0ULL << (vc % 64));
+    while (word == 0) {
+        if (++idx == m_occupied_vcs.size())
+            return -1;
+        word = m_occupied_vcs[idx];
+    }
+    return idx * 64 + findLsbSet(word);
+}
+
 // Send a credit back to upstream router for this VC.
 // Called by SwitchAllocator when the flit in this VC wins the Switch.
 void
@@ -107,9 +107,23 @@ class InputUnit : public Consumer
     inline flit*
     getTopFlit(int vc)
     {
-        return virtualChannels[vc].getTopFlit();
+        flit *t_flit = virtualChannels[vc].getTopFlit();
+        if (virtualChannels[vc].isEmpty())
+            clear_vc_occupied(vc);
+        return t_flit;
     }
 
+    /** Check if any VC of this input port holds flits. */
+    inline bool has_occupied_vcs() const { return m_num_occupied_vcs > 0; }
+
+    /**
+     * Get the first VC holding flits, starting from the given VC.
+     *
+     * @param vc VC to start the search from.
+     * @return The VC, or -1 if no VC from the given one holds flits.
+     */
+    int next_occupied_vc(int vc) const;
+
     inline bool
     need_stage(int vc, flit_stage stage, Tick time)
     {
@@ -147,6 +161,9 @@ class InputUnit : public Consumer
     void resetStats();
 
   private:
+    void set_vc_occupied(int vc);
+    void clear_vc_occupied(int vc);
+
     Router *m_router;
     int m_id;
     PortDirection m_direction;
@@ -158,6 +175,11 @@ class InputUnit : public Consumer
     // Input Virtual channels
     std::vector<VirtualChannel> virtualChannels;
 
+    // Bitmap of the VCs holding flits, so that the allocators only
+    // look at occupied VCs
+    std::vector<uint64_t> m_occupied_vcs;
+    int m_num_occupied_vcs;
+
     // Statistical variables
     std::vector<double> m_num_buffer_writes;
     std::vector<double> m_num_buffer_reads;
@@ -106,7 +106,10 @@ NetworkBridge::scheduleFlit(flit *t_flit, Cycles latency)
     sendTime = std::max(nextAvailTick, sendTime);
     t_flit->set_time(sendTime);
     lastScheduledAt = sendTime;
-    linkBuffer.insert(t_flit);
+    {
+        auto lock = bufferLock();
+        linkBuffer.insert(t_flit);
+    }
     link_consumer->scheduleEventAbsolute(sendTime);
 }
 
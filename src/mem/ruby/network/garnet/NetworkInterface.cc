@@ -35,6 +35,7 @@
 #include <cassert>
 #include <cmath>
 
+#include "base/bitfield.hh"
 #include "base/cast.hh"
 #include "debug/RubyNetwork.hh"
 #include "mem/ruby/network/MessageBuffer.hh"
@@ -53,6 +54,8 @@ NetworkInterface::NetworkInterface(const Params *p)
 {
     m_stall_count.resize(m_virtual_networks);
     niOutVcs.resize(0);
+    m_num_out_flits = 0;
+    m_pending_vnets.resize((m_virtual_networks + 63) / 64, 0);
 }
 
 void
@@ -126,13 +129,38 @@ NetworkInterface::addNode(vector<MessageBuffer *>& in,
     inNode_ptr = in;
     outNode_ptr = out;
 
-    for (auto& it : in) {
-        if (it != nullptr) {
-            it->setConsumer(this);
+    for (int vnet = 0; vnet < in.size(); vnet++) {
+        if (in[vnet] != nullptr) {
+            in[vnet]->setConsumer(this);
+            // Have enqueues report their vnet through storeEventInfo()
+            in[vnet]->setVnet(vnet);
         }
     }
 }
 
+void
+NetworkInterface::storeEventInfo(int info)
+{
+    m_pending_vnets[info / 64] |= 1ULL << (info % 64);
+}
+
+int
+NetworkInterface::next_pending_vnet(int vnet) const
+{
+    if (vnet >= inNode_ptr.size())
+        return -1;
+
+    int idx = vnet / 64;
+    uint64_t word = m_pending_vnets[idx] & (~0ULL << (vnet % 64));
+    while (word == 0) {
+        if (++idx == m_pending_vnets.size())
+            return -1;
+        word = m_pending_vnets[idx];
+    }
+    const int next = idx * 64 + findLsbSet(word);
+    return next < inNode_ptr.size() ? next : -1;
+}
+
 void
 NetworkInterface::dequeueCallback()
 {
@@ -196,11 +224,11 @@ NetworkInterface::wakeup()
 
     // Checking for messages coming from the protocol
     // can pick up a message/cycle for each virtual net
-    for (int vnet = 0; vnet < inNode_ptr.size(); ++vnet) {
+    // Only the vnets which received messages are looked at
+    for (int vnet = next_pending_vnet(0); vnet != -1;
+         vnet = next_pending_vnet(vnet + 1)) {
         MessageBuffer *b = inNode_ptr[vnet];
-        if (b == nullptr) {
-            continue;
-        }
+        assert(b != nullptr);
 
         if (b->isReady(curTime)) { // Is there a message waiting
             msg_ptr = b->peekMsgPtr();
@@ -208,9 +236,15 @@ NetworkInterface::wakeup()
                 b->dequeue(curTime);
             }
         }
+
+        if (b->isEmpty()) {
+            m_pending_vnets[vnet / 64] &= ~(1ULL << (vnet % 64));
+        }
     }
 
-    scheduleOutputLink();
+    // Nothing to send if the output VCs are empty
+    if (m_num_out_flits > 0)
+        scheduleOutputLink();
 
     // Check if there are flits stalling a virtual channel. Track if a
     // message is enqueued to restrict ejection to one message per cycle.
@@ -387,6 +421,10 @@ NetworkInterface::flitisizeMessage(MsgPtr msg_ptr, int vnet)
         if (vc == -1) {
             return false ;
         }
+        // Each destination gets its own copy of the message, sharing the
+        // data block until one of them writes it. A unicast is copied too:
+        // the buffered message is dequeued after it is flitisized, and the
+        // dequeue updates its delayed ticks.
         MsgPtr new_msg_ptr = msg_ptr->clone();
         NodeID destID = dest_nodes[ctr];
 
@@ -437,6 +475,7 @@ NetworkInterface::flitisizeMessage(MsgPtr msg_ptr, int vnet)
 
             fl->set_src_delay(curTick() - msg_ptr->getTime());
             niOutVcs[vc].insert(fl);
+            m_num_out_flits++;
         }
 
         m_ni_out_vcs_enqueue_time[vc] = curTick();
@@ -512,6 +551,7 @@ NetworkInterface::scheduleOutputPort(OutputPort *oPort)
 
                // Just removing the top flit
                flit *t_flit = niOutVcs[vc].getTopFlit();
+               m_num_out_flits--;
                t_flit->set_time(clockEdge(Cycles(1)));
 
                // Scheduling the flit
@@ -614,19 +654,17 @@ NetworkInterface::get_vnet(int vc)
 void
 NetworkInterface::checkReschedule()
 {
-    for (const auto& it : inNode_ptr) {
-        if (it == nullptr) {
-            continue;
-        }
-
-        while (it->isReady(clockEdge())) { // Is there a message waiting
+    for (int vnet = next_pending_vnet(0); vnet != -1;
+         vnet = next_pending_vnet(vnet + 1)) {
+        // Is there a message waiting
+        if (inNode_ptr[vnet]->isReady(clockEdge())) {
             scheduleEvent(Cycles(1));
             return;
         }
     }
 
-    for (auto& ni_out_vc : niOutVcs) {
-        if (ni_out_vc.isReady(clockEdge(Cycles(1)))) {
+    for (int vc = 0; m_num_out_flits > 0 && vc < niOutVcs.size(); vc++) {
+        if (niOutVcs[vc].isReady(clockEdge(Cycles(1)))) {
             scheduleEvent(Cycles(1));
             return;
         }
@@ -662,8 +700,8 @@ uint32_t
 NetworkInterface::functionalWrite(Packet *pkt)
 {
     uint32_t num_functional_writes = 0;
-    for (auto& ni_out_vc : niOutVcs) {
-        num_functional_writes += ni_out_vc.functionalWrite(pkt);
+    for (int vc = 0; m_num_out_flits > 0 && vc < niOutVcs.size(); vc++) {
+        num_functional_writes += niOutVcs[vc].functionalWrite(pkt);
     }
 
     for (auto &oPort: outPorts) {
@@ -62,6 +62,7 @@ class NetworkInterface : public ClockedObject, public Consumer
 
     void dequeueCallback();
     void wakeup();
+    void storeEventInfo(int info);
     void addNode(std::vector<MessageBuffer *> &inNode,
                  std::vector<MessageBuffer *> &outNode);
 
@@ -274,6 +275,13 @@ class NetworkInterface : public ClockedObject, public Consumer
     // The flit buffers which will serve the Consumer
     std::vector<flitBuffer>  niOutVcs;
     std::vector<Tick> m_ni_out_vcs_enqueue_time;
+    // Number of flits in niOutVcs
+    int m_num_out_flits;
+
+    // Bitmap of the vnets whose protocol buffer may hold messages. A
+    // vnet is marked on enqueue and unmarked once its buffer is empty.
+    std::vector<uint64_t> m_pending_vnets;
+    int next_pending_vnet(int vnet) const;
 
     // The Message buffers that takes messages from the protocol
     std::vector<MessageBuffer *> inNode_ptr;
@@ -89,7 +89,10 @@ NetworkLink::wakeup()
                 (mVnets.size() == 0));
         }
         t_flit->set_time(clockEdge(m_latency));
-        linkBuffer.insert(t_flit);
+        {
+            auto lock = bufferLock();
+            linkBuffer.insert(t_flit);
+        }
         link_consumer->scheduleEventAbsolute(clockEdge(m_latency));
         m_link_utilized++;
         m_vc_load[t_flit->get_vc()]++;
@@ -125,5 +128,6 @@ CreditLinkParams::create()
 uint32_t
 NetworkLink::functionalWrite(Packet *pkt)
 {
+    auto lock = bufferLock();
     return linkBuffer.functionalWrite(pkt);
 }
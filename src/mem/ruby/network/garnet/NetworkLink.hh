@@ -34,6 +34,7 @@
 #define __MEM_RUBY_NETWORK_GARNET_0_NETWORKLINK_HH__
 
 #include <iostream>
+#include <mutex>
 #include <vector>
 
 #include "mem/ruby/common/Consumer.hh"
@@ -66,11 +67,23 @@ class NetworkLink : public ClockedObject, public Consumer
 
     inline bool isReady(Tick curTime)
     {
+        auto lock = bufferLock();
         return linkBuffer.isReady(curTime);
     }
 
-    inline flit* peekLink() { return linkBuffer.peekTopFlit(); }
-    inline flit* consumeLink() { return linkBuffer.getTopFlit(); }
+    inline flit*
+    peekLink()
+    {
+        auto lock = bufferLock();
+        return linkBuffer.peekTopFlit();
+    }
+
+    inline flit*
+    consumeLink()
+    {
+        auto lock = bufferLock();
+        return linkBuffer.getTopFlit();
+    }
 
     uint32_t functionalWrite(Packet *);
     void resetStats();
@@ -90,6 +103,19 @@ class NetworkLink : public ClockedObject, public Consumer
     std::vector<unsigned int> m_vc_load;
 
   protected:
+    /**
+     * The link buffer is filled on the event queue of the link and
+     * drained by its consumer, which may run on another event queue.
+     */
+    std::unique_lock<std::mutex>
+    bufferLock()
+    {
+        if (inParallelMode)
+            return std::unique_lock<std::mutex>(m_buffer_mutex);
+        return std::unique_lock<std::mutex>(m_buffer_mutex, std::defer_lock);
+    }
+
+    std::mutex m_buffer_mutex;
     uint32_t m_virt_nets;
     flitBuffer linkBuffer;
     Consumer *link_consumer;
@@ -46,7 +46,7 @@ Router::Router(const Params *p)
     m_virtual_networks(p->virt_nets), m_vc_per_vnet(p->vcs_per_vnet),
     m_num_vcs(m_virtual_networks * m_vc_per_vnet), m_bit_width(p->width),
     m_network_ptr(nullptr), routingUnit(this), switchAllocator(this),
-    crossbarSwitch(this)
+    crossbarSwitch(this), m_num_occupied_vcs(0)
 {
     m_input_unit.clear();
     m_output_unit.clear();
@@ -83,7 +83,10 @@ Router::wakeup()
     }
 
     // Switch Allocation
-    switchAllocator.wakeup();
+    // Only flits buffered in the input VCs can request the switch, so
+    // there is nothing to allocate in an idle router
+    if (m_num_occupied_vcs > 0)
+        switchAllocator.wakeup();
 
     // Switch Traversal
     crossbarSwitch.wakeup();
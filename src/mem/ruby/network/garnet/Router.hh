@@ -110,6 +110,15 @@ class Router : public BasicRouter, public Consumer
     void grant_switch(int inport, flit *t_flit);
     void schedule_wakeup(Cycles time);
 
+    // Track the number of input VCs holding flits in the router
+    void vc_occupied() { m_num_occupied_vcs++; }
+    void
+    vc_freed()
+    {
+        assert(m_num_occupied_vcs > 0);
+        m_num_occupied_vcs--;
+    }
+
     std::string getPortDirectionName(PortDirection direction);
     void printFaultVector(std::ostream& out);
     void printAggregateFaultProbability(std::ostream& out);
@@ -144,6 +153,9 @@ class Router : public BasicRouter, public Consumer
     std::vector<std::shared_ptr<InputUnit>> m_input_unit;
     std::vector<std::shared_ptr<OutputUnit>> m_output_unit;
 
+    // Number of input VCs holding flits, over all input ports
+    int m_num_occupied_vcs;
+
     // Statistical variables required for power computations
     Stats::Scalar m_buffer_reads;
     Stats::Scalar m_buffer_writes;
@@ -56,6 +56,7 @@ SwitchAllocator::init()
     m_round_robin_inport.resize(m_num_outports);
     m_round_robin_invc.resize(m_num_inports);
     m_port_requests.resize(m_num_outports);
+    m_num_port_requests.resize(m_num_outports, 0);
     m_vc_winners.resize(m_num_outports);
 
     for (int i = 0; i < m_num_inports; i++) {
@@ -109,11 +110,20 @@ SwitchAllocator::arbitrate_inports()
     // Select a VC from each input in a round robin manner
     // Independent arbiter at each input port
     for (int inport = 0; inport < m_num_inports; inport++) {
-        int invc = m_round_robin_invc[inport];
+        auto input_unit = m_router->getInputUnit(inport);
+
+        // Only VCs holding flits can be in SA stage, so skip the empty
+        // ones: visit the occupied VCs in round robin order, starting
+        // from the round robin pointer
+        if (!input_unit->has_occupied_vcs())
+            continue;
 
-        for (int invc_iter = 0; invc_iter < m_num_vcs; invc_iter++) {
-            auto input_unit = m_router->getInputUnit(inport);
+        int invc = input_unit->next_occupied_vc(m_round_robin_invc[inport]);
+        if (invc == -1)
+            invc = input_unit->next_occupied_vc(0);
+        const int first_invc = invc;
 
+        do {
             if (input_unit->need_stage(invc, SA_, curTick())) {
                 // This flit is in SA stage
 
@@ -128,16 +138,17 @@ SwitchAllocator::arbitrate_inports()
                 if (make_request) {
                     m_input_arbiter_activity++;
                     m_port_requests[outport][inport] = true;
+                    m_num_port_requests[outport]++;
                     m_vc_winners[outport][inport]= invc;
 
                     break; // got one vc winner for this port
                 }
             }
 
-            invc++;
-            if (invc >= m_num_vcs)
-                invc = 0;
-        }
+            invc = input_unit->next_occupied_vc(invc + 1);
+            if (invc == -1)
+                invc = input_unit->next_occupied_vc(0);
+        } while (invc != first_invc);
     }
 }
 
@@ -162,6 +173,10 @@ SwitchAllocator::arbitrate_outports()
     // Again do round robin arbitration on these requests
     // Independent arbiter at each output port
     for (int outport = 0; outport < m_num_outports; outport++) {
+        // No input placed a request for this outport
+        if (m_num_port_requests[outport] == 0)
+            continue;
+
         int inport = m_round_robin_inport[outport];
 
         for (int inport_iter = 0; inport_iter < m_num_inports;
@@ -237,6 +252,7 @@ SwitchAllocator::arbitrate_outports()
 
                 // remove this request
                 m_port_requests[outport][inport] = false;
+                m_num_port_requests[outport]--;
 
                 // Update Round Robin pointer
                 m_round_robin_inport[outport] = inport + 1;
@@ -359,8 +375,10 @@ SwitchAllocator::check_for_wakeup()
     }
 
     for (int i = 0; i < m_num_inports; i++) {
-        for (int j = 0; j < m_num_vcs; j++) {
-            if (m_router->getInputUnit(i)->need_stage(j, SA_, nextCycle)) {
+        auto input_unit = m_router->getInputUnit(i);
+        for (int j = input_unit->next_occupied_vc(0); j != -1;
+             j = input_unit->next_occupied_vc(j + 1)) {
+            if (input_unit->need_stage(j, SA_, nextCycle)) {
                 m_router->schedule_wakeup(Cycles(1));
                 return;
             }
@@ -383,9 +401,12 @@ void
 SwitchAllocator::clear_request_vector()
 {
     for (int i = 0; i < m_num_outports; i++) {
+        if (m_num_port_requests[i] == 0)
+            continue;
         for (int j = 0; j < m_num_inports; j++) {
             m_port_requests[i][j] = false;
         }
+        m_num_port_requests[i] = 0;
     }
 }
 
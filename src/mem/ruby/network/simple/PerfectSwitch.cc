@@ -239,17 +239,15 @@ PerfectSwitch::operateMessageBuffer(MessageBuffer *buffer, int incoming,
             break; // go to next incoming port
         }
 
-        MsgPtr unmodified_msg_ptr;
-
-        if (output_links.size() > 1) {
-            // If we are sending this message down more than one link
-            // (size>1), we need to make a copy of the message so each
-            // branch can have a different internal destination we need
-            // to create an unmodified MsgPtr because the MessageBuffer
-            // enqueue func will modify the message
-
-            // This magic line creates a private copy of the message
-            unmodified_msg_ptr = msg_ptr->clone();
+        // If we are sending this message down more than one link
+        // (size>1), each branch needs a copy of the message so that it can
+        // have a different internal destination. The copies are taken
+        // before the dequeue and the enqueues modify the message, and the
+        // first link gets the original message. Copies share the data
+        // block of the message until one of them writes it.
+        m_multicast_copies.clear();
+        for (int i = 1; i < output_links.size(); i++) {
+            m_multicast_copies.push_back(msg_ptr->clone());
         }
 
         // Dequeue msg
@@ -261,8 +259,8 @@ PerfectSwitch::operateMessageBuffer(MessageBuffer *buffer, int incoming,
             int outgoing = output_links[i];
 
             if (i > 0) {
-                // create a private copy of the unmodified message
-                msg_ptr = unmodified_msg_ptr->clone();
+                // use the private copy of the unmodified message
+                msg_ptr = std::move(m_multicast_copies[i - 1]);
             }
 
             // Change the internal destination set of the message so it
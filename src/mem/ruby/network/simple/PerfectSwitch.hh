@@ -42,6 +42,7 @@
 
 #include "mem/ruby/common/Consumer.hh"
 #include "mem/ruby/common/TypeDefines.hh"
+#include "mem/ruby/slicc_interface/Message.hh"
 
 class MessageBuffer;
 class NetDest;
@@ -104,6 +105,9 @@ class PerfectSwitch : public Consumer
 
     SimpleNetwork* m_network_ptr;
     std::vector<int> m_pending_message_count;
+
+    // Copies of the message being multicast, kept to reuse the storage
+    std::vector<MsgPtr> m_multicast_copies;
 };
 
 inline std::ostream&
@@ -123,6 +123,20 @@ class AbstractController : public ClockedObject, public Consumer
     virtual int functionalWrite(const Addr &addr, PacketPtr) = 0;
     int functionalMemoryWrite(PacketPtr);
 
+    //! These functions are used by ruby system to restore the contents of
+    //! the caches from a checkpoint without simulating the requests that
+    //! would bring the lines there. For each recorded line,
+    //! functionalInstall() is called on every controller, requestor being
+    //! the controller whose cache held the line; each controller updates
+    //! its own state accordingly. A protocol supports this by defining
+    //! functionalInstall() in all of its machines.
+    virtual bool supportsFunctionalInstall() const { return false; }
+    virtual bool functionalInstall(const MachineID &requestor,
+                                   const Addr &addr,
+                                   const RubyRequestType &type,
+                                   const DataBlock &data)
+    { panic("%s does not support functional install!", name()); }
+
     //! Function for enqueuing a prefetch request
     virtual void enqueuePrefetch(const Addr &, const RubyRequestType&)
     { fatal("Prefetches not implemented!");}
@@ -56,6 +56,7 @@
 #include "mem/ruby/slicc_interface/AbstractCacheEntry.hh"
 #include "mem/ruby/slicc_interface/RubySlicc_ComponentMapping.hh"
 #include "mem/ruby/structures/BankedArray.hh"
+#include "mem/ruby/structures/CacheTagArray.hh"
 #include "mem/ruby/system/CacheRecorder.hh"
 #include "params/RubyCache.hh"
 #include "sim/sim_object.hh"
@@ -195,10 +196,23 @@ class CacheMemory : public SimObject
     // Data Members (m_prefix)
     bool m_is_instruction_only_cache;
 
-    // The first index is the # of cache lines.
-    // The second index is the the amount associativity.
+    // Index of a way in the flat, set-major arrays below.
+    int64_t
+    entryIndex(int64_t cacheSet, int way) const
+    {
+        return cacheSet * m_cache_assoc + way;
+    }
+
+    // The tags and entries of the cache, stored set-major. A lookup only
+    // scans the tags of a set and does not touch an entry unless the tag
+    // matches.
+    CacheTagArray m_tags;
+    std::vector<AbstractCacheEntry*> m_cache;
+
+#ifdef DEBUG
+    // Shadow of m_tags used to cross-check the tag array in debug builds.
     std::unordered_map<Addr, int> m_tag_index;
-    std::vector<std::vector<AbstractCacheEntry*> > m_cache;
+#endif
 
     /**
      * We use BaseReplacementPolicy from Classic system here, hence we can use
@@ -218,14 +232,14 @@ class CacheMemory : public SimObject
     int m_block_size;
 
     /**
-     * We store all the ReplacementData in a 2-dimensional array. By doing
+     * We store all the ReplacementData in a set-major array. By doing
      * this, we can use all replacement policies from Classic system. Ruby
      * cache will deallocate cache entry every time we evict the cache block
      * so we cannot store the ReplacementData inside the cache entry.
      * Instantiate ReplacementData for multiple times will break replacement
      * policy like TreePLRU.
      */
-    std::vector<std::vector<ReplData> > replacement_data;
+    std::vector<ReplData> replacement_data;
 
     /**
      * Set to true when using WeightedLRU replacement policy, otherwise, set to
@@ -0,0 +1,110 @@
+/*
+ * Copyright (c) 2026 The gem5 Authors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __MEM_RUBY_STRUCTURES_CACHETAGARRAY_HH__
+#define __MEM_RUBY_STRUCTURES_CACHETAGARRAY_HH__
+
+#include <cassert>
+#include <cstdint>
+#include <vector>
+
+#include "base/types.hh"
+
+/**
+ * The tags of a set-associative cache, stored set-major: the ways of a
+ * set are contiguous, so a lookup only scans the assoc adjacent tags of
+ * the set. Unused ways hold the tag MaxAddr, which is never a line
+ * address.
+ *
+ * A tag is held by at most one way of its set. Writing a tag into a way
+ * clears it from any other way of the set, so that a stale way left
+ * behind by a protocol never shadows the way that was just filled.
+ */
+class CacheTagArray
+{
+  public:
+    CacheTagArray() : m_assoc(0) {}
+
+    void
+    init(int64_t num_sets, int assoc)
+    {
+        m_assoc = assoc;
+        m_tags.assign(num_sets * assoc, MaxAddr);
+    }
+
+    /**
+     * Find the way of a set holding a tag.
+     *
+     * @return The way holding the tag, or -1 if it is not in the set.
+     */
+    int
+    find(int64_t set, Addr tag) const
+    {
+        // The tag is in at most one way, so the scan has no early exit
+        // and compiles to a branch-free loop over the tags of the set.
+        const Addr *tags = &m_tags[set * m_assoc];
+        int way = -1;
+        for (int i = 0; i < m_assoc; i++) {
+            way = (tags[i] == tag) ? i : way;
+        }
+        return way;
+    }
+
+    /** Get the tag held by a way, MaxAddr if the way is unused. */
+    Addr
+    tag(int64_t set, int way) const
+    {
+        return m_tags[set * m_assoc + way];
+    }
+
+    /** Write a tag into a way, clearing it from the other ways. */
+    void
+    insert(int64_t set, int way, Addr tag)
+    {
+        assert(tag != MaxAddr);
+        Addr *tags = &m_tags[set * m_assoc];
+        for (int i = 0; i < m_assoc; i++) {
+            if (tags[i] == tag)
+                tags[i] = MaxAddr;
+        }
+        tags[way] = tag;
+    }
+
+    /** Mark a way as unused. */
+    void
+    erase(int64_t set, int way)
+    {
+        m_tags[set * m_assoc + way] = MaxAddr;
+    }
+
+  private:
+    int m_assoc;
+    std::vector<Addr> m_tags;
+};
+
+#endif // __MEM_RUBY_STRUCTURES_CACHETAGARRAY_HH__
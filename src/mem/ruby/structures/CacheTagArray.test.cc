@@ -0,0 +1,95 @@
+/*
+ * Copyright (c) 2026 The gem5 Authors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#include "mem/ruby/structures/CacheTagArray.hh"
+
+TEST(CacheTagArrayTest, FindInsertedTags)
+{
+    CacheTagArray tags;
+    tags.init(4, 4);
+
+    tags.insert(1, 2, 0x1000);
+    tags.insert(2, 0, 0x2000);
+    EXPECT_EQ(2, tags.find(1, 0x1000));
+    EXPECT_EQ(0, tags.find(2, 0x2000));
+    EXPECT_EQ(-1, tags.find(1, 0x2000));
+    EXPECT_EQ(-1, tags.find(0, 0x1000));
+    EXPECT_EQ(0x1000, tags.tag(1, 2));
+    EXPECT_EQ(MaxAddr, tags.tag(1, 0));
+}
+
+TEST(CacheTagArrayTest, EraseTag)
+{
+    CacheTagArray tags;
+    tags.init(4, 4);
+
+    tags.insert(1, 3, 0x1000);
+    tags.erase(1, 3);
+    EXPECT_EQ(-1, tags.find(1, 0x1000));
+    EXPECT_EQ(MaxAddr, tags.tag(1, 3));
+}
+
+/**
+ * A line that is deallocated and then allocated again into a different
+ * way must be found in its new way.
+ */
+TEST(CacheTagArrayTest, ReallocateIntoDifferentWay)
+{
+    CacheTagArray tags;
+    tags.init(4, 4);
+
+    tags.insert(1, 0, 0x1000);
+    tags.erase(1, 0);
+    tags.insert(1, 0, 0x3000);
+    tags.insert(1, 2, 0x1000);
+    EXPECT_EQ(2, tags.find(1, 0x1000));
+    EXPECT_EQ(0, tags.find(1, 0x3000));
+}
+
+/**
+ * A line whose entry was left behind in a way of the set, rather than
+ * deallocated, is allocated again into a lower way. The stale way must
+ * not shadow the new one.
+ */
+TEST(CacheTagArrayTest, ReallocateOverStaleWay)
+{
+    CacheTagArray tags;
+    tags.init(4, 4);
+
+    tags.insert(1, 3, 0x1000);
+    tags.insert(1, 1, 0x1000);
+    EXPECT_EQ(1, tags.find(1, 0x1000));
+    EXPECT_EQ(MaxAddr, tags.tag(1, 3));
+
+    // Reusing the stale way for another line leaves the new way intact
+    tags.insert(1, 3, 0x3000);
+    EXPECT_EQ(1, tags.find(1, 0x1000));
+    EXPECT_EQ(3, tags.find(1, 0x3000));
+}
@@ -41,8 +41,10 @@
 #ifndef __MEM_RUBY_STRUCTURES_PERFECTCACHEMEMORY_HH__
 #define __MEM_RUBY_STRUCTURES_PERFECTCACHEMEMORY_HH__
 
-#include <unordered_map>
+#include <deque>
+#include <vector>
 
+#include "base/open_hash_map.hh"
 #include "mem/ruby/common/Address.hh"
 #include "mem/ruby/protocol/AccessPermission.hh"
 
@@ -99,8 +101,17 @@ class PerfectCacheMemory
     PerfectCacheMemory(const PerfectCacheMemory& obj);
     PerfectCacheMemory& operator=(const PerfectCacheMemory& obj);
 
+    // Returns the line of an address, allocating it if it is not present
+    PerfectCacheLineState<ENTRY>& getLine(Addr line_address);
+
     // Data Members (m_prefix)
-    std::unordered_map<Addr, PerfectCacheLineState<ENTRY> > m_map;
+    // Maps the address of each line to its slot in m_lines. The lines
+    // themselves live in a deque so that they never move, and the
+    // pointers returned by lookup() stay valid across allocations.
+    OpenHashMap<Addr, int> m_index;
+    std::deque<PerfectCacheLineState<ENTRY> > m_lines;
+    // Slots of m_lines that are not in use
+    std::vector<int> m_free;
 };
 
 template<class ENTRY>
@@ -123,7 +134,7 @@ template<class ENTRY>
 inline bool
 PerfectCacheMemory<ENTRY>::isTagPresent(Addr address) const
 {
-    return m_map.count(makeLineAddress(address)) > 0;
+    return m_index.count(makeLineAddress(address)) > 0;
 }
 
 template<class ENTRY>
@@ -133,16 +144,35 @@ PerfectCacheMemory<ENTRY>::cacheAvail(Addr address) const
     return true;
 }
 
+template<class ENTRY>
+inline PerfectCacheLineState<ENTRY>&
+PerfectCacheMemory<ENTRY>::getLine(Addr line_address)
+{
+    auto it = m_index.find(line_address);
+    if (it != m_index.end())
+        return m_lines[it->second];
+
+    if (m_free.empty()) {
+        m_free.push_back(m_lines.size());
+        m_lines.emplace_back();
+    }
+    // Lines are reset when they are deallocated
+    const int slot = m_free.back();
+    m_free.pop_back();
+    m_index.emplace(line_address, slot);
+    return m_lines[slot];
+}
+
 // find an Invalid or already allocated entry and sets the tag
 // appropriate for the address
 template<class ENTRY>
 inline void
 PerfectCacheMemory<ENTRY>::allocate(Addr address)
 {
-    PerfectCacheLineState<ENTRY> line_state;
+    PerfectCacheLineState<ENTRY>& line_state =
+        getLine(makeLineAddress(address));
     line_state.m_permission = AccessPermission_Invalid;
     line_state.m_entry = ENTRY();
-    m_map[makeLineAddress(address)] = line_state;
 }
 
 // deallocate entry
@@ -150,8 +180,12 @@ template<class ENTRY>
 inline void
 PerfectCacheMemory<ENTRY>::deallocate(Addr address)
 {
-    auto num_erased M5_VAR_USED = m_map.erase(makeLineAddress(address));
-    assert(num_erased == 1);
+    auto it = m_index.find(makeLineAddress(address));
+    assert(it != m_index.end());
+    const int slot = it->second;
+    m_index.erase(it);
+    m_lines[slot] = PerfectCacheLineState<ENTRY>();
+    m_free.push_back(slot);
 }
 
 // Returns with the physical address of the conflicting cache line
@@ -168,7 +202,7 @@ template<class ENTRY>
 inline ENTRY*
 PerfectCacheMemory<ENTRY>::lookup(Addr address)
 {
-    return &m_map[makeLineAddress(address)].m_entry;
+    return &getLine(makeLineAddress(address)).m_entry;
 }
 
 // looks an address up in the cache
@@ -176,14 +210,19 @@ template<class ENTRY>
 inline const ENTRY*
 PerfectCacheMemory<ENTRY>::lookup(Addr address) const
 {
-    return &m_map[makeLineAddress(address)].m_entry;
+    auto it = m_index.find(makeLineAddress(address));
+    assert(it != m_index.end());
+    return &m_lines[it->second].m_entry;
 }
 
 template<class ENTRY>
 inline AccessPermission
 PerfectCacheMemory<ENTRY>::getPermission(Addr address) const
 {
-    return m_map[makeLineAddress(address)].m_permission;
+    auto it = m_index.find(makeLineAddress(address));
+    if (it == m_index.end())
+        return AccessPermission_NUM;
+    return m_lines[it->second].m_permission;
 }
 
 template<class ENTRY>
@@ -192,7 +231,7 @@ PerfectCacheMemory<ENTRY>::changePermission(Addr address,
                                             AccessPermission new_perm)
 {
     Addr line_address = makeLineAddress(address);
-    PerfectCacheLineState<ENTRY>& line_state = m_map[line_address];
+    PerfectCacheLineState<ENTRY>& line_state = getLine(line_address);
     line_state.m_permission = new_perm;
 }
 
@@ -41,18 +41,32 @@
 #ifndef __MEM_RUBY_STRUCTURES_TBETABLE_HH__
 #define __MEM_RUBY_STRUCTURES_TBETABLE_HH__
 
+#include <deque>
 #include <iostream>
-#include <unordered_map>
+#include <vector>
 
+#include "base/open_hash_map.hh"
 #include "mem/ruby/common/Address.hh"
 
+/**
+ * Table of the transient state of the outstanding transactions of a
+ * controller. The TBEs live in a pool that is allocated upfront for
+ * number_of_TBEs entries and are located through an open-addressed
+ * index, so allocating and deallocating a TBE does not touch the heap.
+ * Pool entries never move, so the pointers returned by lookup() remain
+ * valid until the TBE is deallocated.
+ */
 template<class ENTRY>
 class TBETable
 {
   public:
     TBETable(int number_of_TBEs)
-        : m_number_of_TBEs(number_of_TBEs)
+        : m_index(number_of_TBEs), m_entries(number_of_TBEs),
+          m_number_of_TBEs(number_of_TBEs)
     {
+        m_free.reserve(number_of_TBEs);
+        for (int i = number_of_TBEs - 1; i >= 0; i--)
+            m_free.push_back(i);
     }
 
     bool isPresent(Addr address) const;
@@ -61,7 +75,7 @@ class TBETable
     bool
     areNSlotsAvailable(int n, Tick current_time) const
     {
-        return (m_number_of_TBEs - m_map.size()) >= n;
+        return (m_number_of_TBEs - m_index.size()) >= n;
     }
 
     ENTRY *getNullEntry();
@@ -76,7 +90,13 @@ class TBETable
     TBETable& operator=(const TBETable& obj);
 
     // Data Members (m_prefix)
-    std::unordered_map<Addr, ENTRY> m_map;
+    // Maps the address of each allocated TBE to its slot in m_entries
+    OpenHashMap<Addr, int> m_index;
+    // Pool of TBEs. A deque never moves its elements when it grows, which
+    // only happens if the protocol allocates more than number_of_TBEs.
+    std::deque<ENTRY> m_entries;
+    // Slots of m_entries that are not in use
+    std::vector<int> m_free;
 
   private:
     int m_number_of_TBEs;
@@ -96,8 +116,8 @@ inline bool
 TBETable<ENTRY>::isPresent(Addr address) const
 {
     assert(address == makeLineAddress(address));
-    assert(m_map.size() <= m_number_of_TBEs);
-    return !!m_map.count(address);
+    assert(m_index.size() <= m_number_of_TBEs);
+    return !!m_index.count(address);
 }
 
 template<class ENTRY>
@@ -105,8 +125,14 @@ inline void
 TBETable<ENTRY>::allocate(Addr address)
 {
     assert(!isPresent(address));
-    assert(m_map.size() < m_number_of_TBEs);
-    m_map[address] = ENTRY();
+    assert(m_index.size() < m_number_of_TBEs);
+    if (m_free.empty()) {
+        m_free.push_back(m_entries.size());
+        m_entries.emplace_back();
+    }
+    // Entries are reset when they are deallocated
+    m_index.emplace(address, m_free.back());
+    m_free.pop_back();
 }
 
 template<class ENTRY>
@@ -114,8 +140,12 @@ inline void
 TBETable<ENTRY>::deallocate(Addr address)
 {
     assert(isPresent(address));
-    assert(m_map.size() > 0);
-    m_map.erase(address);
+    assert(m_index.size() > 0);
+    auto it = m_index.find(address);
+    const int slot = it->second;
+    m_index.erase(it);
+    m_entries[slot] = ENTRY();
+    m_free.push_back(slot);
 }
 
 template<class ENTRY>
@@ -130,8 +160,9 @@ template<class ENTRY>
 inline ENTRY*
 TBETable<ENTRY>::lookup(Addr address)
 {
-  if (m_map.find(address) != m_map.end()) return &(m_map.find(address)->second);
-  return NULL;
+    auto it = m_index.find(address);
+    if (it != m_index.end()) return &m_entries[it->second];
+    return NULL;
 }
 
 
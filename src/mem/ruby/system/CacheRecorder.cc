@@ -30,6 +30,7 @@
 #include "mem/ruby/system/CacheRecorder.hh"
 
 #include "debug/RubyCacheTrace.hh"
+#include "mem/ruby/slicc_interface/AbstractController.hh"
 #include "mem/ruby/system/RubySystem.hh"
 #include "mem/ruby/system/Sequencer.hh"
 
@@ -150,6 +151,40 @@ CacheRecorder::enqueueNextFetchRequest()
     }
 }
 
+void
+CacheRecorder::installRecords(const std::vector<AbstractController*> &cntrls)
+{
+    const uint64_t block_size = RubySystem::getBlockSizeBytes();
+    DataBlock data;
+
+    while (m_bytes_read < m_uncompressed_trace_size) {
+        TraceRecord* traceRecord = (TraceRecord*) (m_uncompressed_trace +
+                                                                m_bytes_read);
+
+        DPRINTF(RubyCacheTrace, "Installing %s\n", *traceRecord);
+
+        assert(traceRecord->m_cntrl_id < cntrls.size());
+        const MachineID requestor =
+            cntrls[traceRecord->m_cntrl_id]->getMachineID();
+
+        for (int rec_bytes_read = 0; rec_bytes_read < m_block_size_bytes;
+                rec_bytes_read += block_size) {
+            data.setData(traceRecord->m_data + rec_bytes_read, 0,
+                         block_size);
+            for (auto cntrl : cntrls) {
+                cntrl->functionalInstall(requestor,
+                    traceRecord->m_data_address + rec_bytes_read,
+                    traceRecord->m_type, data);
+            }
+        }
+
+        m_bytes_read += (sizeof(TraceRecord) + m_block_size_bytes);
+        m_records_read++;
+    }
+
+    DPRINTF(RubyCacheTrace, "Installed all %d records\n", m_records_read);
+}
+
 void
 CacheRecorder::addRecord(int cntrl, Addr data_addr, Addr pc_addr,
                          RubyRequestType type, Tick time, DataBlock& data)
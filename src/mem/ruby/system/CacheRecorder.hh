@@ -43,6 +43,7 @@
 #include "mem/ruby/common/TypeDefines.hh"
 #include "mem/ruby/protocol/RubyRequestType.hh"
 
+class AbstractController;
 class Sequencer;
 
 /*!
@@ -97,6 +98,14 @@ class CacheRecorder
      */
     void enqueueNextFetchRequest();
 
+    /*!
+     * Function for warming up the caches without timing simulation. It
+     * goes through the recorded contents of the caches and installs each
+     * line directly in the controllers, which must all support
+     * functionalInstall().
+     */
+    void installRecords(const std::vector<AbstractController*> &cntrls);
+
   private:
     // Private copy constructor and assignment operator
     CacheRecorder(const CacheRecorder& obj);
@@ -61,6 +61,45 @@
 
 using namespace std;
 
+namespace
+{
+
+/**
+ * Stop all event queues for the duration of a functional access. With
+ * parallel event queues, the controllers' caches, TBEs and buffers are
+ * updated by the threads of the queues they belong to, while the
+ * functional access runs on the thread of its requestor. The queues
+ * are locked in ascending order, after releasing the current queue, so
+ * that concurrent functional accesses cannot deadlock.
+ */
+class ScopedEventQueuesStop
+{
+  public:
+    ScopedEventQueuesStop()
+      : doStop(inParallelMode)
+    {
+        if (doStop) {
+            curEventQueue()->unlock();
+            for (uint32_t i = 0; i < numMainEventQueues; i++)
+                mainEventQueue[i]->lock();
+        }
+    }
+
+    ~ScopedEventQueuesStop()
+    {
+        if (doStop) {
+            for (uint32_t i = numMainEventQueues; i > 0; i--)
+                mainEventQueue[i - 1]->unlock();
+            curEventQueue()->lock();
+        }
+    }
+
+  private:
+    const bool doStop;
+};
+
+} // anonymous namespace
+
 bool RubySystem::m_randomization;
 uint32_t RubySystem::m_block_size_bytes;
 uint32_t RubySystem::m_block_size_bits;
@@ -73,6 +112,7 @@ bool RubySystem::m_cooldown_enabled = false;
 
 RubySystem::RubySystem(const Params *p)
     : ClockedObject(p), m_access_backing_store(p->access_backing_store),
+      m_functional_warmup(p->functional_warmup),
       m_cache_recorder(NULL)
 {
     m_randomization = p->randomization;
@@ -90,6 +130,10 @@ RubySystem::RubySystem(const Params *p)
     // Create the profiler
     m_profiler = new Profiler(p, this);
     m_phys_mem = p->phys_mem;
+
+    // Ruby controllers cannot be searched for the lines they hold, so
+    // functional accesses must always go through them
+    p->system->disableBulkFunctionalAccess();
 }
 
 void
@@ -424,18 +468,32 @@ RubySystem::startup()
     // state was checkpointed.
 
     if (m_warmup_enabled) {
-        DPRINTF(RubyCacheTrace, "Starting ruby cache warmup\n");
-        // save the current tick value
-        Tick curtick_original = curTick();
-        // save the event queue head
-        Event* eventq_head = eventq->replaceHead(NULL);
-        // set curTick to 0 and reset Ruby System's clock
-        setCurTick(0);
-        resetClock();
-
-        // Schedule an event to start cache warmup
-        enqueueRubyEvent(curTick());
-        simulate();
+        if (m_functional_warmup && canInstallFunctionally()) {
+            // The protocol can install the recorded lines directly, which
+            // involves neither the event queue nor the clock.
+            DPRINTF(RubyCacheTrace,
+                    "Starting functional ruby cache warmup\n");
+            m_cache_recorder->installRecords(m_abs_cntrl_vec);
+        } else {
+            DPRINTF(RubyCacheTrace, "Starting ruby cache warmup\n");
+            // save the current tick value
+            Tick curtick_original = curTick();
+            // save the event queue head
+            Event* eventq_head = eventq->replaceHead(NULL);
+            // set curTick to 0 and reset Ruby System's clock
+            setCurTick(0);
+            resetClock();
+
+            // Schedule an event to start cache warmup
+            enqueueRubyEvent(curTick());
+            simulate();
+
+            // Restore eventq head
+            eventq->replaceHead(eventq_head);
+            // Restore curTick and Ruby System's clock
+            setCurTick(curtick_original);
+            resetClock();
+        }
 
         delete m_cache_recorder;
         m_cache_recorder = NULL;
@@ -443,17 +501,24 @@ RubySystem::startup()
         if (m_systems_to_warmup == 0) {
             m_warmup_enabled = false;
         }
-
-        // Restore eventq head
-        eventq->replaceHead(eventq_head);
-        // Restore curTick and Ruby System's clock
-        setCurTick(curtick_original);
-        resetClock();
     }
 
     resetStats();
 }
 
+bool
+RubySystem::canInstallFunctionally() const
+{
+    for (auto cntrl : m_abs_cntrl_vec) {
+        if (!cntrl->supportsFunctionalInstall()) {
+            DPRINTF(RubyCacheTrace, "%s cannot install lines functionally\n",
+                    cntrl->name());
+            return false;
+        }
+    }
+    return true;
+}
+
 void
 RubySystem::processRubyEvent()
 {
@@ -476,6 +541,8 @@ RubySystem::resetStats()
 bool
 RubySystem::functionalRead(PacketPtr pkt)
 {
+    ScopedEventQueuesStop stop_queues;
+
     Addr address(pkt->getAddr());
     Addr line_address = makeLineAddress(address);
 
@@ -596,6 +663,8 @@ RubySystem::functionalRead(PacketPtr pkt)
 bool
 RubySystem::functionalWrite(PacketPtr pkt)
 {
+    ScopedEventQueuesStop stop_queues;
+
     Addr addr(pkt->getAddr());
     Addr line_addr = makeLineAddress(addr);
     AccessPermission access_perm = AccessPermission_NotPresent;
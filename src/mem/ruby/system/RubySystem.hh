@@ -123,6 +123,10 @@ class RubySystem : public ClockedObject
                                      uint64_t uncompressed_trace_size);
 
     void processRubyEvent();
+
+    // Whether all the controllers can install lines functionally, so that
+    // the cache warmup can skip the timing simulation.
+    bool canInstallFunctionally() const;
   private:
     // configuration parameters
     static bool m_randomization;
@@ -135,6 +139,7 @@ class RubySystem : public ClockedObject
     static bool m_cooldown_enabled;
     SimpleMemory *m_phys_mem;
     const bool m_access_backing_store;
+    const bool m_functional_warmup;
 
     //std::vector<Network *> m_networks;
     std::vector<std::unique_ptr<Network>> m_networks;
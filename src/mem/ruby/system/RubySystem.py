@@ -47,6 +47,10 @@ class RubySystem(ClockedObject):
     access_backing_store = Param.Bool(False, "Use phys_mem as the functional \
         store and only use ruby for timing.")
 
+    functional_warmup = Param.Bool(True, "When restoring from a checkpoint, \
+        install the recorded cache contents directly in the controllers if \
+        the protocol supports it, rather than replaying them as requests.")
+
     # Profiler related configuration variables
     hot_lines = Param.Bool(False, "")
     all_instructions = Param.Bool(False, "")
@@ -416,6 +416,28 @@ SerialLink::SerialLinkRequestPort::trySatisfyFunctional(PacketPtr pkt)
     return found;
 }
 
+bool
+SerialLink::SerialLinkResponsePort::findHeldLines(
+    Addr addr, Addr size, std::vector<Addr> &lines) const
+{
+    for (const auto &p : transmitList) {
+        if (carriesData(p.pkt, addr, size))
+            return false;
+    }
+    return true;
+}
+
+bool
+SerialLink::SerialLinkRequestPort::findHeldLines(
+    Addr addr, Addr size, std::vector<Addr> &lines) const
+{
+    for (const auto &p : transmitList) {
+        if (carriesData(p.pkt, addr, size))
+            return false;
+    }
+    return true;
+}
+
 AddrRangeList
 SerialLink::SerialLinkResponsePort::getAddrRanges() const
 {
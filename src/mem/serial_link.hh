@@ -51,6 +51,7 @@
 #include <deque>
 
 #include "base/types.hh"
+#include "mem/functional_data_holder.hh"
 #include "mem/port.hh"
 #include "params/SerialLink.hh"
 #include "sim/clocked_object.hh"
@@ -91,7 +92,8 @@ class SerialLink : public ClockedObject
      * is responsible for. The CPU-side port also has a buffer for the
      * responses not yet sent.
      */
-    class SerialLinkResponsePort : public ResponsePort
+    class SerialLinkResponsePort : public ResponsePort,
+                                   public FunctionalDataHolder
     {
 
       private:
@@ -178,6 +180,13 @@ class SerialLink : public ClockedObject
          */
         void retryStalledReq();
 
+        /**
+         * Report that the serial link cannot tell which lines are held
+         * if a queued response carries data of the range.
+         */
+        bool findHeldLines(Addr addr, Addr size,
+                           std::vector<Addr> &lines) const override;
+
       protected:
 
         /** When receiving a timing request from the peer port,
@@ -207,7 +216,8 @@ class SerialLink : public ClockedObject
      * responses. The memory-side port has a buffer for the requests not
      * yet sent.
      */
-    class SerialLinkRequestPort : public RequestPort
+    class SerialLinkRequestPort : public RequestPort,
+                                  public FunctionalDataHolder
     {
 
       private:
@@ -287,6 +297,13 @@ class SerialLink : public ClockedObject
          */
         bool trySatisfyFunctional(PacketPtr pkt);
 
+        /**
+         * Report that the serial link cannot tell which lines are held
+         * if a queued request carries data of the range.
+         */
+        bool findHeldLines(Addr addr, Addr size,
+                           std::vector<Addr> &lines) const override;
+
       protected:
 
         /** When receiving a timing request from the peer port,
@@ -108,6 +108,17 @@ void SimpleMemory::recvFunctional(PacketPtr pkt)
     pkt->popLabel();
 }
 
+bool
+SimpleMemory::findHeldLines(Addr addr, Addr size,
+                            std::vector<Addr> &lines) const
+{
+    for (const auto &p : packetQueue) {
+        if (carriesData(p.pkt, addr, size))
+            return false;
+    }
+    return true;
+}
+
 bool SimpleMemory::recvTimingReq(PacketPtr pkt, int port_id)
 {
     panic_if(pkt->cacheResponding(), "Should not see packets where cache "
@@ -49,6 +49,7 @@
 #include <list>
 
 #include "mem/abstract_mem.hh"
+#include "mem/functional_data_holder.hh"
 #include "mem/port.hh"
 #include "params/SimpleMemory.hh"
 
@@ -58,7 +59,7 @@
  *
  * @sa  \ref gem5MemorySystem "gem5 Memory System"
  */
-class SimpleMemory : public AbstractMemory
+class SimpleMemory : public AbstractMemory, public FunctionalDataHolder
 {
 
   private:
@@ -192,6 +193,13 @@ class SimpleMemory : public AbstractMemory
                   PortID idx=InvalidPortID) override;
     void init() override;
 
+    /**
+     * Report that the memory cannot tell which lines are held if a
+     * queued response carries data of the range.
+     */
+    bool findHeldLines(Addr addr, Addr size,
+                       std::vector<Addr> &lines) const override;
+
   protected:
     Tick recvAtomic(PacketPtr pkt);
     Tick recvAtomicBackdoor(PacketPtr pkt, MemBackdoorPtr &_backdoor);
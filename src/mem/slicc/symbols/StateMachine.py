@@ -285,6 +285,7 @@ class $py_ident(RubyController):
 #include <sstream>
 #include <string>
 
+#include "config/ruby_transition_profiling.hh"
 #include "mem/ruby/common/Consumer.hh"
 #include "mem/ruby/protocol/TransitionResult.hh"
 #include "mem/ruby/protocol/Types.hh"
@@ -335,6 +336,19 @@ class $c_ident : public AbstractController
     uint64_t getEventCount(${ident}_Event event);
     bool isPossible(${ident}_State state, ${ident}_Event event);
     uint64_t getTransitionCount(${ident}_State state, ${ident}_Event event);
+#if RUBY_TRANSITION_PROFILING
+    double getTransitionHostTime(${ident}_State state, ${ident}_Event event);
+#endif
+''')
+
+        # Machines that define functionalInstall() can have their state
+        # restored without replaying the cache trace
+        if any(func.c_name == "functionalInstall" for func in self.functions):
+            code('''
+    bool supportsFunctionalInstall() const { return true; }
+''')
+
+        code('''
 
 private:
 ''')
@@ -388,6 +402,12 @@ static std::vector<Stats::Vector *> eventVec;
 static std::vector<std::vector<Stats::Vector *> > transVec;
 static int m_num_controllers;
 
+#if RUBY_TRANSITION_PROFILING
+// Host time, in seconds, spent simulating each transition
+double m_transition_host_time[${ident}_State_NUM][${ident}_Event_NUM];
+static std::vector<std::vector<Stats::Vector *> > transHostTimeVec;
+#endif
+
 // Internal functions
 ''')
 
@@ -542,6 +562,9 @@ ${c_ident}Params::create()
 int $c_ident::m_num_controllers = 0;
 std::vector<Stats::Vector *>  $c_ident::eventVec;
 std::vector<std::vector<Stats::Vector *> >  $c_ident::transVec;
+#if RUBY_TRANSITION_PROFILING
+std::vector<std::vector<Stats::Vector *> >  $c_ident::transHostTimeVec;
+#endif
 
 // for adding information to the protocol debug trace
 stringstream ${ident}_transitionComment;
@@ -591,6 +614,9 @@ for (int state = 0; state < ${ident}_State_NUM; state++) {
     for (int event = 0; event < ${ident}_Event_NUM; event++) {
         m_possible[state][event] = false;
         m_counters[state][event] = 0;
+#if RUBY_TRANSITION_PROFILING
+        m_transition_host_time[state][event] = 0;
+#endif
     }
 }
 for (int event = 0; event < ${ident}_Event_NUM; event++) {
@@ -847,6 +873,28 @@ $c_ident::regStats()
                 transVec[state].push_back(t);
             }
         }
+
+#if RUBY_TRANSITION_PROFILING
+        for (${ident}_State state = ${ident}_State_FIRST;
+             state < ${ident}_State_NUM; ++state) {
+
+            transHostTimeVec.push_back(std::vector<Stats::Vector *>());
+
+            for (${ident}_Event event = ${ident}_Event_FIRST;
+                 event < ${ident}_Event_NUM; ++event) {
+
+                Stats::Vector *t = new Stats::Vector();
+                t->init(m_num_controllers);
+                t->name(params()->ruby_system->name() + ".${c_ident}." +
+                        ${ident}_State_to_string(state) +
+                        "." + ${ident}_Event_to_string(event) +
+                        ".host_seconds");
+                t->desc("Host time spent simulating the transition");
+                t->flags(Stats::total | Stats::oneline | Stats::nozero);
+                transHostTimeVec[state].push_back(t);
+            }
+        }
+#endif
     }
 }
 
@@ -878,6 +926,11 @@ $c_ident::collateStats()
                 assert(it != rs->m_abstract_controls[MachineType_${ident}].end());
                 (*transVec[state][event])[i] =
                     (($c_ident *)(*it).second)->getTransitionCount(state, event);
+#if RUBY_TRANSITION_PROFILING
+                (*transHostTimeVec[state][event])[i] =
+                    (($c_ident *)(*it).second)->getTransitionHostTime(state,
+                                                                      event);
+#endif
             }
         }
     }
@@ -916,6 +969,15 @@ $c_ident::getTransitionCount(${ident}_State state,
     return m_counters[state][event];
 }
 
+#if RUBY_TRANSITION_PROFILING
+double
+$c_ident::getTransitionHostTime(${ident}_State state,
+                                ${ident}_Event event)
+{
+    return m_transition_host_time[state][event];
+}
+#endif
+
 int
 $c_ident::getNumControllers()
 {
@@ -951,6 +1013,9 @@ void $c_ident::resetStats()
     for (int state = 0; state < ${ident}_State_NUM; state++) {
         for (int event = 0; event < ${ident}_Event_NUM; event++) {
             m_counters[state][event] = 0;
+#if RUBY_TRANSITION_PROFILING
+            m_transition_host_time[state][event] = 0;
+#endif
         }
     }
 
@@ -1264,17 +1329,113 @@ ${ident}_Controller::wakeup()
 
         code.write(path, "%s_Wakeup.cc" % self.ident)
 
+    def transitionCases(self):
+        '''Returns the code of the transitions, deduplicated. The result
+        maps each distinct code block of doTransitionWorker to the list of
+        (state, event) pairs that execute it.'''
+
+        ident = self.ident
+        # This map will allow suppress generating duplicate code
+        cases = OrderedDict()
+
+        for trans in self.transitions:
+            case_string = (trans.state.ident, trans.event.ident)
+
+            case = self.symtab.codeFormatter()
+            # Only set next_state if it changes
+            if trans.state != trans.nextState:
+                if trans.nextState.isWildcard():
+                    # When * is encountered as an end state of a transition,
+                    # the next state is determined by calling the
+                    # machine-specific getNextState function. The next state
+                    # is determined before any actions of the transition
+                    # execute, and therefore the next state calculation cannot
+                    # depend on any of the transitionactions.
+                    case('next_state = getNextState(addr);')
+                else:
+                    ns_ident = trans.nextState.ident
+                    case('next_state = ${ident}_State_${ns_ident};')
+
+            actions = trans.actions
+            request_types = trans.request_types
+
+            # Check for resources
+            case_sorter = []
+            res = trans.resources
+            for key,val in res.items():
+                val = '''
+if (!%s.areNSlotsAvailable(%s, clockEdge()))
+    return TransitionResult_ResourceStall;
+''' % (key.code, val)
+                case_sorter.append(val)
+
+            # Check all of the request_types for resource constraints
+            for request_type in request_types:
+                val = '''
+if (!checkResourceAvailable(%s_RequestType_%s, addr)) {
+    return TransitionResult_ResourceStall;
+}
+''' % (self.ident, request_type.ident)
+                case_sorter.append(val)
+
+            # Emit the code sequences in a sorted order.  This makes the
+            # output deterministic (without this the output order can vary
+            # since Map's keys() on a vector of pointers is not deterministic
+            for c in sorted(case_sorter):
+                case("$c")
+
+            # Record access types for this transition
+            for request_type in request_types:
+                case('recordRequestType(${ident}_RequestType_${{request_type.ident}}, addr);')
+
+            # Figure out if we stall
+            stall = False
+            for action in actions:
+                if action.ident == "z_stall":
+                    stall = True
+                    break
+
+            if stall:
+                case('return TransitionResult_ProtocolStall;')
+            else:
+                if self.TBEType != None and self.EntryType != None:
+                    for action in actions:
+                        case('${{action.ident}}(m_tbe_ptr, m_cache_entry_ptr, addr);')
+                elif self.TBEType != None:
+                    for action in actions:
+                        case('${{action.ident}}(m_tbe_ptr, addr);')
+                elif self.EntryType != None:
+                    for action in actions:
+                        case('${{action.ident}}(m_cache_entry_ptr, addr);')
+                else:
+                    for action in actions:
+                        case('${{action.ident}}(addr);')
+                case('return TransitionResult_Valid;')
+
+            case = str(case)
+
+            # Look to see if this transition code is unique.
+            if case not in cases:
+                cases[case] = []
+
+            cases[case].append(case_string)
+
+        return cases
+
     def printCSwitch(self, path):
         '''Output switch statement for transition table'''
 
         code = self.symtab.codeFormatter()
         ident = self.ident
+        cases = self.transitionCases()
 
         code('''
 // Auto generated C++ code started by $__file__:$__line__
 // ${ident}: ${{self.short}}
 
 #include <cassert>
+#include <chrono>
+#include <cstdint>
 
 #include "base/logging.hh"
 #include "base/trace.hh"
@@ -1286,10 +1447,39 @@ ${ident}_Controller::wakeup()
 #include "mem/ruby/protocol/Types.hh"
 #include "mem/ruby/system/RubySystem.hh"
 
-#define HASH_FUN(state, event)  ((int(state)*${ident}_Event_NUM)+int(event))
-
 #define GET_TRANSITION_COMMENT() (${ident}_transitionComment.str())
 #define CLEAR_TRANSITION_COMMENT() (${ident}_transitionComment.str(""))
+''')
+
+        # Dense (state x event) table giving the case of doTransitionWorker
+        # that implements each transition, 0 if the transition is invalid.
+        # This keeps the switch compact, so that the compiler turns it into
+        # a jump table rather than a search over sparse hash values.
+        case_index = {}
+        for index,transitions in enumerate(cases.values(), 1):
+            for trans in transitions:
+                case_index[trans] = index
+        index_type = "uint8_t" if len(cases) < 256 else "uint16_t"
+        num_states = len(self.states)
+        num_events = len(self.events)
+
+        code('''
+
+static_assert(${ident}_State_NUM == $num_states &&
+              ${ident}_Event_NUM == $num_events,
+              "${ident} transition table does not match the state machine");
+
+static constexpr $index_type
+${ident}_transitionTable[${ident}_State_NUM][${ident}_Event_NUM] = {
+''')
+        code.indent()
+        for state in self.states.values():
+            row = [ str(case_index.get((state.ident, event.ident), 0))
+                    for event in self.events.values() ]
+            code('{ ${{", ".join(row)}} }, // ${{state.ident}}')
+        code.dedent()
+        code('''
+};
 
 TransitionResult
 ${ident}_Controller::doTransition(${ident}_Event event,
@@ -1324,6 +1514,10 @@ DPRINTF(RubyGenerated, "%s, Time: %lld, state: %s, event: %s, addr: %#x\\n",
         *this, curCycle(), ${ident}_State_to_string(state),
         ${ident}_Event_to_string(event), addr);
 
+#if RUBY_TRANSITION_PROFILING
+auto host_start = std::chrono::steady_clock::now();
+#endif
+
 TransitionResult result =
 ''')
         if self.TBEType != None and self.EntryType != None:
@@ -1335,6 +1529,14 @@ TransitionResult result =
         else:
             code('doTransitionWorker(event, state, next_state, addr);')
 
+        code('''
+
+#if RUBY_TRANSITION_PROFILING
+m_transition_host_time[state][event] += std::chrono::duration<double>(
+    std::chrono::steady_clock::now() - host_start).count();
+#endif
+''')
+
         port_to_buf_map, in_msg_bufs, msg_bufs = self.getBufferMaps(ident)
 
         code('''
@@ -1407,102 +1609,18 @@ ${ident}_Controller::doTransitionWorker(${ident}_Event event,
         code('''
                                         Addr addr)
 {
-    switch(HASH_FUN(state, event)) {
+    switch (${ident}_transitionTable[state][event]) {
 ''')
 
-        # This map will allow suppress generating duplicate code
-        cases = OrderedDict()
-
-        for trans in self.transitions:
-            case_string = "%s_State_%s, %s_Event_%s" % \
-                (self.ident, trans.state.ident, self.ident, trans.event.ident)
-
-            case = self.symtab.codeFormatter()
-            # Only set next_state if it changes
-            if trans.state != trans.nextState:
-                if trans.nextState.isWildcard():
-                    # When * is encountered as an end state of a transition,
-                    # the next state is determined by calling the
-                    # machine-specific getNextState function. The next state
-                    # is determined before any actions of the transition
-                    # execute, and therefore the next state calculation cannot
-                    # depend on any of the transitionactions.
-                    case('next_state = getNextState(addr);')
-                else:
-                    ns_ident = trans.nextState.ident
-                    case('next_state = ${ident}_State_${ns_ident};')
-
-            actions = trans.actions
-            request_types = trans.request_types
-
-            # Check for resources
-            case_sorter = []
-            res = trans.resources
-            for key,val in res.items():
-                val = '''
-if (!%s.areNSlotsAvailable(%s, clockEdge()))
-    return TransitionResult_ResourceStall;
-''' % (key.code, val)
-                case_sorter.append(val)
-
-            # Check all of the request_types for resource constraints
-            for request_type in request_types:
-                val = '''
-if (!checkResourceAvailable(%s_RequestType_%s, addr)) {
-    return TransitionResult_ResourceStall;
-}
-''' % (self.ident, request_type.ident)
-                case_sorter.append(val)
-
-            # Emit the code sequences in a sorted order.  This makes the
-            # output deterministic (without this the output order can vary
-            # since Map's keys() on a vector of pointers is not deterministic
-            for c in sorted(case_sorter):
-                case("$c")
-
-            # Record access types for this transition
-            for request_type in request_types:
-                case('recordRequestType(${ident}_RequestType_${{request_type.ident}}, addr);')
-
-            # Figure out if we stall
-            stall = False
-            for action in actions:
-                if action.ident == "z_stall":
-                    stall = True
-                    break
-
-            if stall:
-                case('return TransitionResult_ProtocolStall;')
-            else:
-                if self.TBEType != None and self.EntryType != None:
-                    for action in actions:
-                        case('${{action.ident}}(m_tbe_ptr, m_cache_entry_ptr, addr);')
-                elif self.TBEType != None:
-                    for action in actions:
-                        case('${{action.ident}}(m_tbe_ptr, addr);')
-                elif self.EntryType != None:
-                    for action in actions:
-                        case('${{action.ident}}(m_cache_entry_ptr, addr);')
-                else:
-                    for action in actions:
-                        case('${{action.ident}}(addr);')
-                case('return TransitionResult_Valid;')
-
-            case = str(case)
-
-            # Look to see if this transition code is unique.
-            if case not in cases:
-                cases[case] = []
-
-            cases[case].append(case_string)
 
         # Walk through all of the unique code blocks and spit out the
-        # corresponding case statement elements
-        for case,transitions in cases.items():
-            # Iterative over all the multiple transitions that share
-            # the same code
-            for trans in transitions:
-                code('  case HASH_FUN($trans):')
+        # corresponding case statement elements, numbered as in the
+        # transition table
+        for index,(case,transitions) in enumerate(cases.items(), 1):
+            # List all the transitions that share the same code
+            for state,event in transitions:
+                code('  // ${state}, ${event}')
+            code('  case $index:')
             code('    $case\n')
 
         code('''
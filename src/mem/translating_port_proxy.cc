@@ -53,7 +53,8 @@
 TranslatingPortProxy::TranslatingPortProxy(
         ThreadContext *tc, Request::Flags _flags) :
     PortProxy(tc->getCpuPtr()->getSendFunctional(),
-              tc->getSystemPtr()->cacheLineSize()), _tc(tc),
+              tc->getSystemPtr()->cacheLineSize(),
+              tc->getCpuPtr()->getBulkAccessFunc()), _tc(tc),
               pageBytes(tc->getSystemPtr()->getPageBytes()),
               flags(_flags)
 {}
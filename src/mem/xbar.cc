@@ -58,6 +58,7 @@ BaseXBar::BaseXBar(const BaseXBarParams *p)
       responseLatency(p->response_latency),
       headerLatency(p->header_latency),
       width(p->width),
+      routeTo(p->route_table_size),
       gotAddrRanges(p->port_default_connection_count +
                           p->port_mem_side_ports_connection_count, false),
       gotAllAddrRanges(false), defaultPortID(InvalidPortID),
@@ -67,10 +68,34 @@ BaseXBar::BaseXBar(const BaseXBarParams *p)
       pktCount(this, "pkt_count",
               "Packet count per connected requestor and responder (bytes)"),
       pktSize(this, "pkt_size", "Cumulative packet size per connected "
-             "requestor and responder (bytes)")
+             "requestor and responder (bytes)"),
+      routeTableOccupancy(this, "route_table_occupancy",
+              "Average number of requests in the routing table"),
+      routeTableMaxOccupancy(this, "route_table_max_occupancy",
+              "Maximum number of requests in the routing table")
 {
 }
 
+void
+BaseXBar::addRoute(const RequestPtr &req, PortID port_id)
+{
+    const auto M5_VAR_USED ret = routeTo.emplace(req, port_id);
+    assert(ret.second);
+
+    routeTableOccupancy = routeTo.size();
+    if (routeTo.size() > routeTableMaxOccupancy.value()) {
+        routeTableMaxOccupancy = routeTo.size();
+    }
+}
+
+void
+BaseXBar::removeRoute(const RequestPtr &req)
+{
+    const auto M5_VAR_USED erased = routeTo.erase(req);
+    assert(erased);
+    routeTableOccupancy = routeTo.size();
+}
+
 BaseXBar::~BaseXBar()
 {
     for (auto port: memSidePorts)
@@ -577,6 +602,13 @@ BaseXBar::regStats()
             pktSize.ysubname(j, memSidePorts[j]->getPeer().name());
         }
     }
+
+    routeTableOccupancy
+        .precision(2)
+        .flags(nozero);
+
+    routeTableMaxOccupancy
+        .flags(nozero);
 }
 
 template <typename SrcType, typename DstType>
@@ -47,9 +47,9 @@
 #define __MEM_XBAR_HH__
 
 #include <deque>
-#include <unordered_map>
 
 #include "base/addr_range_map.hh"
+#include "base/open_hash_map.hh"
 #include "base/types.hh"
 #include "mem/qport.hh"
 #include "params/BaseXBar.hh"
@@ -319,9 +319,25 @@ class BaseXBar : public ClockedObject
      * Remember where request packets came from so that we can route
      * responses to the appropriate port. This relies on the fact that
      * the underlying Request pointer inside the Packet stays
-     * constant.
+     * constant. The table is flat and sized upfront, so that adding
+     * and removing routes does not allocate memory.
      */
-    std::unordered_map<RequestPtr, PortID> routeTo;
+    OpenHashMap<RequestPtr, PortID> routeTo;
+
+    /**
+     * Remember the port a request came from, to route its response.
+     *
+     * @param req The request.
+     * @param port_id Port the response must be sent through.
+     */
+    void addRoute(const RequestPtr &req, PortID port_id);
+
+    /**
+     * Remove a route once the response has been routed.
+     *
+     * @param req The request whose route is removed.
+     */
+    void removeRoute(const RequestPtr &req);
 
     /** all contigous ranges seen by this crossbar */
     AddrRangeList xbarRanges;
@@ -400,6 +416,10 @@ class BaseXBar : public ClockedObject
     Stats::Vector2d pktCount;
     Stats::Vector2d pktSize;
 
+    /** Occupancy of the routing table. */
+    Stats::Average routeTableOccupancy;
+    Stats::Scalar routeTableMaxOccupancy;
+
   public:
 
     virtual ~BaseXBar();
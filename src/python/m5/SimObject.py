@@ -115,6 +115,10 @@ allClasses = {}
 # dict to look up SimObjects based on path
 instanceDict = {}
 
+# sorted param and port names of each SimObject class, used when
+# creating the C++ param structs
+sortedNames = {}
+
 # Did any of the SimObjects lack a header file?
 noCxxHeader = False
 
@@ -1220,6 +1224,7 @@ class SimObject(object):
         self._name = None
         self._ccObject = None  # pointer to C++ object
         self._ccParams = None
+        self._path = None # only cached once the hierarchy is final
         self._instantiated = False # really "cloned"
 
         # Clone children specified at class level.  No need for a
@@ -1440,6 +1445,8 @@ class SimObject(object):
                 self.add_child(key, val)
 
     def path(self):
+        if self._path is not None:
+            return self._path
         if not self._parent:
             return '<orphan %s>' % self.__class__
         elif isinstance(self._parent, MetaSimObject):
@@ -1524,10 +1531,23 @@ class SimObject(object):
     def unproxy(self, base):
         return self
 
-    def unproxyParams(self):
+    # Cache the path of this object. This may only be done once the
+    # hierarchy can't change anymore, i.e., when instantiating it.
+    def freezePath(self):
+        self._path = None
+        self._path = self.path()
+
+    # Resolve the proxies in the params and ports of this object. The
+    # optional config cache provides the params resolved when the same
+    # configuration was last instantiated, and records the others.
+    def unproxyParams(self, cache=None):
         for param in self._params.keys():
             value = self._values.get(param)
             if value != None and isproxy(value):
+                cached = cache.lookup(self, param) if cache else None
+                if cached is not None:
+                    setattr(self, param, cached)
+                    continue
                 try:
                     value = value.unproxy(self)
                 except:
@@ -1535,6 +1555,8 @@ class SimObject(object):
                           (param, self.path()))
                     raise
                 setattr(self, param, value)
+                if cache:
+                    cache.record(self, param, value)
 
         # Unproxy ports in sorted order so that 'append' operations on
         # vector ports are done in a deterministic fashion.
@@ -1615,8 +1637,12 @@ class SimObject(object):
         cc_params = cc_params_struct()
         cc_params.name = str(self)
 
-        param_names = list(self._params.keys())
-        param_names.sort()
+        names = sortedNames.get(self.__class__)
+        if names is None:
+            names = (sorted(self._params.keys()), sorted(self._ports.keys()))
+            sortedNames[self.__class__] = names
+        param_names, port_names = names
+
         for param in param_names:
             value = self._values.get(param)
             if value is None:
@@ -1639,8 +1665,6 @@ class SimObject(object):
             else:
                 setattr(cc_params, param, value)
 
-        port_names = list(self._ports.keys())
-        port_names.sort()
         for port_name in port_names:
             port = self._port_refs.get(port_name, None)
             if port != None:
@@ -0,0 +1,160 @@
+# Copyright (c) 2026 The gem5 Authors
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are
+# met: redistributions of source code must retain the above copyright
+# notice, this list of conditions and the following disclaimer;
+# redistributions in binary form must reproduce the above copyright
+# notice, this list of conditions and the following disclaimer in the
+# documentation and/or other materials provided with the distribution;
+# neither the name of the copyright holders nor the names of its
+# contributors may be used to endorse or promote products derived from
+# this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+# A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+# OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+# SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+# LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+# THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+"""Cache of the resolved proxy parameters of a configuration
+
+Resolving Parent.any, Parent.all and attribute proxies searches the
+SimObject hierarchy, which is a large part of instantiate() for big
+configurations. When a proxy resolves to SimObjects, the result only
+depends on the hierarchy, the classes of its objects and their
+SimObject valued parameters. The results are therefore stored in a file
+named after a hash of those, and reused whenever the same configuration
+is instantiated again, e.g., by many short jobs of the same script.
+
+Proxies that resolve to other values are always resolved, since they
+are cheap to resolve or have side effects, like NextEthernetAddr.
+"""
+
+from __future__ import print_function
+from __future__ import absolute_import
+
+import hashlib
+import json
+import os
+
+from . import proxy
+from .SimObject import isSimObject
+from .util import warn
+
+# Version of the cache files, to be bumped when their format changes
+_version = 1
+
+# The names of the classes a SimObject class derives from, per class
+_class_signatures = {}
+
+def _classSignature(cls):
+    sig = _class_signatures.get(cls)
+    if sig is None:
+        sig = ' '.join('%s.%s' % (c.__module__, c.__name__)
+                       for c in cls.__mro__)
+        _class_signatures[cls] = sig
+    return sig
+
+# The part of a param value that proxies resolving to SimObjects can
+# depend on. Other values are left out.
+def _valueSignature(value):
+    if isinstance(value, proxy.BaseProxy):
+        return str(value)
+    elif isSimObject(value):
+        return value.path()
+    elif isinstance(value, (list, tuple)):
+        return '[%s]' % ','.join(_valueSignature(v) for v in value)
+    else:
+        return ''
+
+class ConfigCache(object):
+    def __init__(self, directory, sim_objects):
+        self._directory = directory
+        self._objects = dict((obj.path(), obj) for obj in sim_objects)
+
+        h = hashlib.sha1()
+        for obj in sim_objects:
+            lines = [ obj.path(), _classSignature(type(obj)) ]
+            for param in sorted(obj._params.keys()):
+                lines.append('%s:%s=%s' % (param,
+                    obj._params[param].ptype_str,
+                    _valueSignature(obj._values.get(param))))
+            h.update(('\n'.join(lines) + '\n\n').encode('utf-8'))
+        self._filename = os.path.join(directory, h.hexdigest() + '.json')
+
+        # The resolved params, as the paths of the objects they resolve
+        # to, per object path
+        self._params = {}
+        self._hit = False
+        try:
+            with open(self._filename) as f:
+                data = json.load(f)
+            if data.get('version') == _version:
+                self._params = data['params']
+                self._hit = True
+        except (IOError, OSError, ValueError, KeyError):
+            pass
+
+    def lookup(self, obj, param):
+        """Get the cached value of a proxy param, None if not cached."""
+        value = self._params.get(obj.path(), {}).get(param)
+        if value is None:
+            return None
+        elif isinstance(value, list):
+            return [ self._objects[path] for path in value ]
+        else:
+            return self._objects[value]
+
+    def record(self, obj, param, value):
+        """Record the value a proxy param resolved to."""
+        if self._hit:
+            return
+
+        if isSimObject(value):
+            values = [ value ]
+        elif isinstance(value, (list, tuple)) and value:
+            values = value
+        else:
+            return
+
+        paths = []
+        for v in values:
+            if not isSimObject(v) or v.path() not in self._objects:
+                return
+            paths.append(v.path())
+
+        self._params.setdefault(obj.path(), {})[param] = \
+            paths[0] if isSimObject(value) else paths
+
+    def save(self):
+        """Write the cache file, unless it was loaded from one."""
+        if self._hit:
+            return
+
+        # Write a temporary file and rename it, so that concurrent jobs
+        # never load a partial cache file
+        tmp_filename = '%s.%d.tmp' % (self._filename, os.getpid())
+        if not os.path.isdir(self._directory):
+            try:
+                os.makedirs(self._directory)
+            except OSError:
+                # Another job may have created it in the meantime
+                pass
+        try:
+            with open(tmp_filename, 'w') as f:
+                json.dump({ 'version' : _version, 'params' : self._params },
+                          f)
+            os.rename(tmp_filename, self._filename)
+        except (IOError, OSError) as e:
+            warn("Can't write config cache file '%s': %s",
+                 self._filename, e)
+            if os.path.exists(tmp_filename):
+                os.remove(tmp_filename)
@@ -39,5 +39,5 @@
 from __future__ import print_function
 from __future__ import absolute_import
 
-from _m5.core import setOutputDir
+from _m5.core import setOutputDir, convertCheckpoint
 from _m5.loader import setInterpDir
@@ -115,6 +115,9 @@ def parse_options():
     group("Statistics Options")
     option("--stats-file", metavar="FILE", default="stats.txt",
         help="Sets the output file for statistics [Default: %default]")
+    option("--stats-filter", metavar="PATTERN[,PATTERN]", action='append',
+        split=',',
+        help="Only dump the stats matching one of these wildcard patterns")
     option("--stats-help",
            action="callback", callback=_stats_help,
            help="Display documentation for available stat visitors")
@@ -130,6 +133,10 @@ def parse_options():
     option("--dot-dvfs-config", metavar="FILE", default=None,
         help="Create DOT & pdf outputs of the DVFS configuration" + \
              " [Default: %default]")
+    option("--config-cache", metavar="DIR", default=None,
+        help="Cache the resolved proxy parameters of the configuration in "
+             "DIR, and reuse them when the same configuration is "
+             "instantiated again [Default: %default]")
 
     # Debugging options
     group("Debugging Options")
@@ -146,8 +153,20 @@ def parse_options():
         help="End debug output at TICK")
     option("--debug-file", metavar="FILE", default="cout",
         help="Sets the output file for debug [Default: %default]")
+    option("--debug-format", metavar="FORMAT", default="text",
+        choices=["text", "binary"],
+        help="Debug output format, text or binary. Binary output needs "
+             "a --debug-file. Binary traces are rendered with "
+             "util/decode_debug_trace.py [Default: %default]")
+    option("--debug-ring", metavar="BYTES", type='int', default=0,
+        help="Only keep roughly the last BYTES of binary debug output, "
+             "written out when the simulation exits (0 keeps "
+             "everything) [Default: %default]")
     option("--debug-ignore", metavar="EXPR", action='append', split=':',
         help="Ignore EXPR sim objects")
+    option("--event-profile", metavar="FILE", default=None,
+        help="Profile the host time spent processing each event and "
+             "write a report to FILE on exit")
     option("--remote-gdb-port", type='int', default=7000,
         help="Remote gdb base port (set to 0 to disable listening)")
 
@@ -365,6 +384,8 @@ def main(*args):
 
     # set stats options
     stats.addStatVisitor(options.stats_file)
+    if options.stats_filter:
+        stats.setFilter(options.stats_filter)
 
     # Disable listeners unless running interactively or explicitly
     # enabled
@@ -419,12 +440,18 @@ def main(*args):
         e = event.create(trace.disable, event.Event.Debug_Enable_Pri)
         event.mainq.schedule(e, options.debug_end)
 
-    trace.output(options.debug_file)
+    if options.debug_format == "binary":
+        trace.binaryOutput(options.debug_file, options.debug_ring)
+    else:
+        trace.output(options.debug_file)
 
     for ignore in options.debug_ignore:
         _check_tracing()
         trace.ignore(ignore)
 
+    if options.event_profile:
+        event.enableProfiling(options.event_profile)
+
     sys.argv = arguments
     sys.path = [ os.path.dirname(sys.argv[0]) ] + sys.path
 
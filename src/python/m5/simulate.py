@@ -48,6 +48,7 @@ import _m5.drain
 import _m5.core
 from _m5.stats import updateEvents as updateStatEvents
 
+from . import config_cache
 from . import stats
 from . import SimObject
 from . import ticks
@@ -69,6 +70,10 @@ _memory_modes = {
 
 _drain_manager = _m5.drain.DrainManager.instance()
 
+# All SimObjects in the hierarchy, in descendants() order. This is set
+# by instantiate().
+_sim_objects = []
+
 # The final hook to generate .ini files.  Called from the user script
 # once the config is built.
 def instantiate(ckpt_dir=None):
@@ -86,13 +91,25 @@ def instantiate(ckpt_dir=None):
     # hierarchy so we catch them with future descendants() walks
     for obj in root.descendants(): obj.adoptOrphanParams()
 
+    # The hierarchy doesn't change from here on, so walk it once and
+    # use the same list for all the passes below. Walking it is
+    # expensive for large configurations.
+    global _sim_objects
+    _sim_objects = list(root.descendants())
+    for obj in _sim_objects: obj.freezePath()
+
     # Unproxy in sorted order for determinism
-    for obj in root.descendants(): obj.unproxyParams()
+    cache = None
+    if options.config_cache:
+        cache = config_cache.ConfigCache(options.config_cache, _sim_objects)
+    for obj in _sim_objects: obj.unproxyParams(cache)
+    if cache:
+        cache.save()
 
     if options.dump_config:
         ini_file = open(os.path.join(options.outdir, options.dump_config), 'w')
         # Print ini sections in sorted order for easier diffing
-        for obj in sorted(root.descendants(), key=lambda o: o.path()):
+        for obj in sorted(_sim_objects, key=lambda o: o.path()):
             obj.print_ini(ini_file)
         ini_file.close()
 
@@ -115,21 +132,21 @@ def instantiate(ckpt_dir=None):
     stats.initSimStats()
 
     # Create the C++ sim objects and connect ports
-    for obj in root.descendants(): obj.createCCObject()
-    for obj in root.descendants(): obj.connectPorts()
+    for obj in _sim_objects: obj.createCCObject()
+    for obj in _sim_objects: obj.connectPorts()
 
     # Do a second pass to finish initializing the sim objects
-    for obj in root.descendants(): obj.init()
+    for obj in _sim_objects: obj.init()
 
     # Do a third pass to initialize statistics
     stats._bindStatHierarchy(root)
     root.regStats()
 
     # Do a fourth pass to initialize probe points
-    for obj in root.descendants(): obj.regProbePoints()
+    for obj in _sim_objects: obj.regProbePoints()
 
     # Do a fifth pass to connect probe listeners
-    for obj in root.descendants(): obj.regProbeListeners()
+    for obj in _sim_objects: obj.regProbeListeners()
 
     # We want to generate the DVFS diagram for the system. This can only be
     # done once all of the CPP objects have been created and initialised so
@@ -145,9 +162,9 @@ def instantiate(ckpt_dir=None):
         _drain_manager.preCheckpointRestore()
         ckpt = _m5.core.getCheckpoint(ckpt_dir)
         _m5.core.unserializeGlobals(ckpt);
-        for obj in root.descendants(): obj.loadState(ckpt)
+        for obj in _sim_objects: obj.loadState(ckpt)
     else:
-        for obj in root.descendants(): obj.initState()
+        for obj in _sim_objects: obj.initState()
 
     # Check to see if any of the stat events are in the past after resuming from
     # a checkpoint, If so, this call will shift them to be at a valid time.
@@ -158,8 +175,7 @@ def simulate(*args, **kwargs):
     global need_startup
 
     if need_startup:
-        root = objects.Root.getInstance()
-        for obj in root.descendants(): obj.startup()
+        for obj in _sim_objects: obj.startup()
         need_startup = False
 
         # Python exit handlers happen in reverse order.
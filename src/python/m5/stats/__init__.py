@@ -77,6 +77,13 @@ def _url_factory(schemes, enable=True):
         enable: Enable/disable this factory. Typically used when the
                 presence of a function depends on some runtime property.
 
+    All factories additionally accept a "delta" parameter. When it is
+    True, the output only receives the stats that changed since the
+    previous dump. Setting the "async" parameter to True moves the
+    formatting and writing of the stats to a background thread, and
+    "pending" sets the number of dumps that can be waiting to be
+    written (default: 2) before a dump blocks the simulation.
+
     For example:
         wrapped_f(urlparse.urlsplit("text://stats.txt?desc=False")) ->
         f("stats.txt", desc=False)
@@ -116,12 +123,21 @@ def _url_factory(schemes, enable=True):
                               % (url.geturl(), values[0]))
 
             kwargs = dict([ parse_value(k, v) for k, v in qs.items() ])
+            delta = kwargs.pop("delta", False)
+            async_dump = kwargs.pop("async", False)
+            pending = kwargs.pop("pending", 2)
 
             try:
-                return func("%s%s" % (url.netloc, url.path), **kwargs)
+                output = func("%s%s" % (url.netloc, url.path), **kwargs)
             except TypeError:
                 fatal("Illegal stat visitor parameter specified")
 
+            if delta:
+                output = _m5.stats.initDelta(output)
+            if async_dump:
+                output = _m5.stats.initAsync(output, pending)
+            return output
+
         all_factories.append((wrapper, schemes, enable))
         for scheme in schemes:
             assert scheme not in factories
@@ -185,6 +201,31 @@ def _hdf5Factory(fn, chunking=10, desc=True, formulas=True):
 
     return _m5.stats.initHDF5(fn, chunking, desc, formulas)
 
+@_url_factory([ "bin", "binary", ])
+def _binaryFactory(fn, compress=True):
+    """Output stats in a compact binary format.
+
+    Binary stat files are designed for frequent periodic stat dumps.
+    The names and shapes of all stats are stored once, and each dump
+    only appends the current tick and the raw stat values. This makes
+    dumps much cheaper and files much smaller than the text format.
+
+    Each dump can optionally be compressed using zlib. Use the
+    m5.stats.binary module to read the file back as numpy arrays.
+
+    Known limitations:
+      * Sparse histograms are currently unsupported.
+
+    Parameters:
+      * compress (bool): Compress each dump (default: True)
+
+    Example:
+      bin://stats.bin?compress=False
+
+    """
+
+    return _m5.stats.initBinary(fn, compress)
+
 def addStatVisitor(url):
     """Add a stat visitor specified using a URL string
 
@@ -194,7 +235,10 @@ def addStatVisitor(url):
     The available formats are listed in the factories list. Factories
     are called with the path as the first positional parameter and the
     parameters are keyword arguments. Parameter values must be valid
-    Python literals.
+    Python literals. Every format supports the "delta" parameter to only
+    output the stats that changed since the previous dump, and the
+    "async" parameter to write the stats on a background thread, e.g.:
+    text://stats.txt?delta=True;async=True
 
     """
 
@@ -326,6 +370,89 @@ def prepare():
     # New stats
     _visit_stats(lambda g, s: s.prepare())
 
+# Compiled stat name filter, None when all stats are dumped.
+_filter = None
+# Selected stats for each dump root, computed on first use of a
+# filter. Keys are root paths ('' for the whole hierarchy), values are
+# (stats, [(group name, plan)]) trees without unselected stats, or None
+# if nothing under the root is selected.
+_filter_plans = {}
+
+def setFilter(patterns, regex=False):
+    '''Restrict stat dumps to a subset of the stats.
+
+    Only the stats whose full name (e.g., "system.cpu.ipc") matches
+    one of the patterns are prepared and passed to the outputs.
+    Unselected stats are never evaluated, which makes frequent dumps
+    of a few stats cheap on large systems.
+
+    Arguments:
+        patterns: List of shell-style wildcard patterns (or regular
+                  expressions if regex is True). An empty list or None
+                  selects all stats.
+        regex: Interpret the patterns as regular expressions matching
+               the beginning of the stat name.
+    '''
+
+    import re
+
+    global _filter
+    if not patterns:
+        _filter = None
+    else:
+        if not regex:
+            import fnmatch
+            patterns = [ fnmatch.translate(p) for p in patterns ]
+        _filter = re.compile("|".join("(?:%s)" % p for p in patterns))
+    _filter_plans.clear()
+
+def _filter_plan(root=None):
+    key = ".".join(root.path_list()) if root else ""
+    if key in _filter_plans:
+        return _filter_plans[key]
+
+    def plan_group(group, prefix):
+        stats = [ s for s in group.getStats() \
+                  if _filter.match(prefix + s.name) ]
+        groups = []
+        for n, g in group.getStatGroups().items():
+            plan = plan_group(g, prefix + n + ".")
+            if plan:
+                groups.append((n, plan))
+        return (stats, groups) if stats or groups else None
+
+    if root:
+        plan = plan_group(root, key + ".")
+    else:
+        # Legacy stats already have their full name
+        legacy = [ s for s in stats_list if _filter.match(s.name) ]
+        plan = plan_group(Root.getInstance(), "")
+        if legacy:
+            plan = (legacy + (plan[0] if plan else []),
+                    plan[1] if plan else [])
+
+    _filter_plans[key] = plan
+    return plan
+
+def _visit_plan(plan, stat_visitor, group_visitor=None):
+    stats, groups = plan
+    for stat in stats:
+        stat_visitor(stat)
+    for n, g in groups:
+        if group_visitor:
+            group_visitor.beginGroup(n)
+        _visit_plan(g, stat_visitor, group_visitor)
+        if group_visitor:
+            group_visitor.endGroup()
+
+def _prepare_filtered(roots):
+    '''Prepare only the stats selected by the current filter.'''
+
+    for root in (roots or [ None ]):
+        plan = _filter_plan(root)
+        if plan:
+            _visit_plan(plan, lambda s: s.prepare())
+
 def _dump_to_visitor(visitor, roots=None):
     # New stats
     def dump_group(group):
@@ -336,14 +463,25 @@ def _dump_to_visitor(visitor, roots=None):
             dump_group(g)
             visitor.endGroup()
 
+    def dump_plan(root):
+        plan = _filter_plan(root)
+        if plan:
+            _visit_plan(plan, lambda s: s.visit(visitor), visitor)
+
     if roots:
         # New stats from selected subroots.
         for root in roots:
             for p in root.path_list():
                 visitor.beginGroup(p)
-            dump_group(root)
+            if _filter:
+                dump_plan(root)
+            else:
+                dump_group(root)
             for p in reversed(root.path_list()):
                 visitor.endGroup()
+    elif _filter:
+        # Legacy and new stats selected by the filter
+        dump_plan(None)
     else:
         # Legacy stats
         for stat in stats_list:
@@ -383,7 +521,10 @@ def dump(roots=None):
         sim_root = Root.getInstance()
         if sim_root:
             sim_root.preDumpStats();
-        prepare()
+        if _filter:
+            _prepare_filtered(all_roots)
+        else:
+            prepare()
 
     for output in outputList:
         if output.valid():
@@ -0,0 +1,289 @@
+# Copyright (c) 2026 The gem5 Authors
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are
+# met: redistributions of source code must retain the above copyright
+# notice, this list of conditions and the following disclaimer;
+# redistributions in binary form must reproduce the above copyright
+# notice, this list of conditions and the following disclaimer in the
+# documentation and/or other materials provided with the distribution;
+# neither the name of the copyright holders nor the names of its
+# contributors may be used to endorse or promote products derived from
+# this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+# A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+# OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+# SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+# LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+# THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+"""Reader for binary stat files
+
+This module reads the files written by the binary stat output (see
+src/base/stats/binary.hh). It only depends on the standard library and
+numpy, so it can also be used outside of gem5, either by loading it
+directly or by running it as a script:
+
+    python3 src/python/m5/stats/binary.py m5out/stats.bin system.cpu.ipc
+
+Example:
+
+    f = StatsFile("m5out/stats.bin")
+    ticks = f.ticks                    # one entry per dump
+    ipc = f["system.cpu.ipc"]          # shape: (dumps,)
+    hits = f["system.cpu.dcache.overallHits"] # shape: (dumps, n)
+
+Values are returned as numpy arrays where the first dimension is the
+dump. Distributions store DIST_FIELDS followed by their buckets in the
+last dimension. Dumps in which a stat wasn't present are filled with
+NaN. Stats left out of a delta frame (written with delta=True) have the
+values of the previous dump.
+"""
+
+from __future__ import print_function
+
+import struct
+import zlib
+
+__all__ = [ 'StatsFile', 'Stat', 'KINDS', 'DIST_FIELDS' ]
+
+MAGIC = b"gem5stat"
+VERSION = 1
+
+RECORD_SCHEMA = 1
+RECORD_FRAME = 2
+RECORD_DELTA_FRAME = 3
+FLAG_COMPRESSED = 0x1
+
+KINDS = {
+    0 : "scalar",
+    1 : "vector",
+    2 : "vector2d",
+    3 : "dist",
+    4 : "vectordist",
+    5 : "formula",
+}
+
+DIST_FIELDS = (
+    "min", "max", "bucket_size", "min_val", "max_val", "underflow",
+    "overflow", "sum", "squares", "logs", "samples",
+)
+
+class Stat(object):
+    """Description of a single stat in the file"""
+
+    def __init__(self, name, kind, shape, desc, subnames, y_subnames):
+        self.name = name
+        self.kind = kind
+        self.shape = shape
+        self.desc = desc
+        self.subnames = subnames
+        self.y_subnames = y_subnames
+
+    @property
+    def size(self):
+        size = 1
+        for dim in self.shape:
+            size *= dim
+        return size
+
+    def __repr__(self):
+        return "Stat(%s, %s, %s)" % (self.name, self.kind, self.shape)
+
+class _Reader(object):
+    def __init__(self, data, order):
+        self.data = data
+        self.order = order
+        self.pos = 0
+
+    def unpack(self, fmt):
+        fmt = self.order + fmt
+        values = struct.unpack_from(fmt, self.data, self.pos)
+        self.pos += struct.calcsize(fmt)
+        return values
+
+    def uint(self, fmt="I"):
+        return self.unpack(fmt)[0]
+
+    def string(self):
+        size = self.uint()
+        value = self.data[self.pos:self.pos + size].decode("utf-8")
+        self.pos += size
+        return value
+
+    def strings(self):
+        return [ self.string() for _ in range(self.uint()) ]
+
+class StatsFile(object):
+    """A binary stat file
+
+    The whole file is read when the object is created. A file may
+    contain several segments if the set of stats changed between two
+    dumps; stats are merged across segments by name.
+    """
+
+    def __init__(self, path):
+        import numpy
+
+        self._numpy = numpy
+        with open(path, "rb") as f:
+            data = f.read()
+
+        if data[:len(MAGIC)] != MAGIC:
+            raise ValueError("%s: not a binary stat file" % path)
+
+        bom = struct.unpack_from("<I", data, len(MAGIC))[0]
+        if bom == 0x01020304:
+            self._order = "<"
+        elif bom == 0x04030201:
+            self._order = ">"
+        else:
+            raise ValueError("%s: invalid byte order mark" % path)
+
+        reader = _Reader(data, self._order)
+        reader.pos = len(MAGIC) + 4
+        version = reader.uint()
+        if version != VERSION:
+            raise ValueError("%s: unsupported version %d" % (path, version))
+
+        # List of (schema, list of frame value arrays, stats in schema
+        # order)
+        self._segments = []
+        ticks = []
+        while reader.pos + 24 <= len(data):
+            rtype, flags, size, raw_size = reader.unpack("IIQQ")
+            payload = data[reader.pos:reader.pos + size]
+            reader.pos += size
+            if len(payload) != size:
+                # Truncated record, e.g. the simulation is still running
+                break
+            if flags & FLAG_COMPRESSED:
+                payload = zlib.decompress(payload)
+            assert len(payload) == raw_size
+
+            if rtype == RECORD_SCHEMA:
+                schema, entries = self._parseSchema(payload)
+                self._segments.append((schema, [], entries))
+            elif rtype == RECORD_FRAME:
+                if not self._segments:
+                    raise ValueError("%s: frame without schema" % path)
+                ticks.append(struct.unpack_from(
+                    self._order + "Q", payload, 0)[0])
+                values = numpy.frombuffer(payload, offset=8,
+                                          dtype=self._order + "f8")
+                self._segments[-1][1].append(values)
+            elif rtype == RECORD_DELTA_FRAME:
+                if not self._segments or not self._segments[-1][1]:
+                    raise ValueError("%s: delta frame without a frame" % \
+                                     path)
+                ticks.append(struct.unpack_from(
+                    self._order + "Q", payload, 0)[0])
+                _, frames, entries = self._segments[-1]
+                frames.append(
+                    self._parseDeltaFrame(payload, entries, frames[-1]))
+            else:
+                raise ValueError("%s: unknown record type %d" % \
+                                 (path, rtype))
+
+        self.ticks = numpy.array(ticks, dtype=numpy.uint64)
+
+        # Stat descriptions by name, keeping the last description seen
+        self.stats = {}
+        for schema, _, _ in self._segments:
+            for stat, _ in schema.values():
+                self.stats[stat.name] = stat
+
+    def _parseSchema(self, payload):
+        reader = _Reader(payload, self._order)
+        schema = {}
+        entries = []
+        offset = 0
+        for _ in range(reader.uint()):
+            kind = KINDS[reader.uint("B")]
+            shape = tuple(reader.uint() for _ in range(reader.uint()))
+            name = reader.string()
+            desc = reader.string()
+            subnames = reader.strings()
+            y_subnames = reader.strings()
+            stat = Stat(name, kind, shape, desc, subnames, y_subnames)
+            schema[name] = (stat, offset)
+            entries.append((stat, offset))
+            offset += stat.size
+        return schema, entries
+
+    def _parseDeltaFrame(self, payload, entries, last):
+        numpy = self._numpy
+        bitmap = bytearray(payload[8:8 + (len(entries) + 7) // 8])
+        pos = 8 + len(bitmap)
+        values = last.copy()
+        for i, (stat, offset) in enumerate(entries):
+            if not (bitmap[i // 8] >> (i % 8)) & 1:
+                continue
+            values[offset:offset + stat.size] = numpy.frombuffer(
+                payload, offset=pos, count=stat.size,
+                dtype=self._order + "f8")
+            pos += stat.size * 8
+        return values
+
+    def names(self):
+        """Names of all stats in the file"""
+        return sorted(self.stats.keys())
+
+    def __contains__(self, name):
+        return name in self.stats
+
+    def __getitem__(self, name):
+        numpy = self._numpy
+        stat = self.stats[name]
+        parts = []
+        for schema, frames, _ in self._segments:
+            if not frames:
+                continue
+            entry = schema.get(name)
+            if entry is None or entry[0].shape != stat.shape:
+                part = numpy.full((len(frames), stat.size), numpy.nan)
+            else:
+                offset = entry[1]
+                part = numpy.stack(
+                    [ f[offset:offset + stat.size] for f in frames ])
+            parts.append(part)
+
+        if not parts:
+            return numpy.empty((0, ) + stat.shape)
+        return numpy.concatenate(parts).reshape((-1, ) + stat.shape)
+
+def main():
+    import argparse
+
+    parser = argparse.ArgumentParser(
+        description="Print stats from a binary stat file")
+    parser.add_argument("file", help="binary stat file")
+    parser.add_argument("stats", nargs="*",
+                        help="stats to print (default: list all stats)")
+    args = parser.parse_args()
+
+    f = StatsFile(args.file)
+    if not args.stats:
+        for name in f.names():
+            stat = f.stats[name]
+            print("%s %s %s" % (name, stat.kind,
+                                "x".join(str(d) for d in stat.shape)))
+        return
+
+    columns = [ f[name].reshape(len(f.ticks), -1) for name in args.stats ]
+    print(",".join([ "tick" ] + args.stats))
+    for i, tick in enumerate(f.ticks):
+        row = [ str(tick) ]
+        for column in columns:
+            row.append(" ".join(repr(float(v)) for v in column[i]))
+        print(",".join(row))
+
+if __name__ == "__main__":
+    main()
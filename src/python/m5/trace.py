@@ -29,3 +29,4 @@ from __future__ import absolute_import
 
 # Export native methods to Python
 from _m5.trace import output, ignore, disable, enable
+from _m5.trace import binaryOutput, formatBinaryTrace
@@ -279,6 +279,7 @@ pybind_init_core(py::module &m_native)
         .def("getCheckpoint", [](const std::string &cpt_dir) {
             return new CheckpointIn(cpt_dir, pybindSimObjectResolver);
         })
+        .def("convertCheckpoint", &CheckpointIn::convertToBinary)
 
         ;
 
@@ -42,12 +42,18 @@
 #include "pybind11/pybind11.h"
 #include "pybind11/stl.h"
 
+#include <fstream>
+#include <iostream>
 #include <map>
+#include <stdexcept>
+#include <string>
 #include <vector>
 
 #include "base/debug.hh"
+#include "base/logging.hh"
 #include "base/output.hh"
 #include "base/trace.hh"
+#include "base/trace_binary.hh"
 #include "sim/debug.hh"
 
 namespace py = pybind11;
@@ -67,6 +73,40 @@ output(const char *filename)
     Trace::setDebugLogger(new Trace::OstreamLogger(*file_stream->stream()));
 }
 
+static void
+binaryOutput(const char *filename, size_t ring_size)
+{
+    OutputStream *file_stream = simout.find(filename);
+
+    if (!file_stream)
+        file_stream = simout.create(filename, true, true);
+
+    const std::ostream *stream = file_stream->stream();
+    fatal_if(stream == &std::cout || stream == &std::cerr,
+             "Binary debug output can't be written to %s, "
+             "use --debug-file to select a file.\n", filename);
+
+    Trace::setDebugLogger(
+        new Trace::BinaryLogger(*file_stream->stream(), ring_size));
+}
+
+static void
+formatBinaryTrace(const std::string &in_name, const std::string &out_name)
+{
+    std::ifstream in(in_name, std::ios::in | std::ios::binary);
+    if (!in)
+        throw std::runtime_error("Failed to open " + in_name);
+
+    if (out_name.empty()) {
+        Trace::formatBinaryTrace(in, std::cout);
+    } else {
+        std::ofstream out(out_name);
+        if (!out)
+            throw std::runtime_error("Failed to open " + out_name);
+        Trace::formatBinaryTrace(in, out);
+    }
+}
+
 static void
 ignore(const char *expr)
 {
@@ -119,6 +159,10 @@ pybind_init_debug(py::module &m_native)
     py::module m_trace = m_native.def_submodule("trace");
     m_trace
         .def("output", &output)
+        .def("binaryOutput", &binaryOutput,
+             py::arg("filename"), py::arg("ring_size") = 0)
+        .def("formatBinaryTrace", &formatBinaryTrace,
+             py::arg("in_name"), py::arg("out_name") = "")
         .def("ignore", &ignore)
         .def("enable", &Trace::enable)
         .def("disable", &Trace::disable)
@@ -44,6 +44,9 @@
 #include "pybind11/stl.h"
 
 #include "base/statistics.hh"
+#include "base/stats/async.hh"
+#include "base/stats/binary.hh"
+#include "base/stats/delta.hh"
 #include "base/stats/text.hh"
 #if USE_HDF5
 #include "base/stats/hdf5.hh"
@@ -102,6 +105,9 @@ pybind_init_stats(py::module &m_native)
 #if USE_HDF5
         .def("initHDF5", &Stats::initHDF5)
 #endif
+        .def("initAsync", &Stats::initAsync, py::keep_alive<0, 1>())
+        .def("initBinary", &Stats::initBinary)
+        .def("initDelta", &Stats::initDelta, py::keep_alive<0, 1>())
         .def("registerPythonStatsHandlers",
              &Stats::registerPythonStatsHandlers)
         .def("schedStatEvent", &Stats::schedStatEvent)
@@ -48,6 +48,11 @@ from m5.objects.SimpleMemory import *
 class MemoryMode(Enum): vals = ['invalid', 'atomic', 'timing',
                                 'atomic_noncaching']
 
+class BackingStoreHugePages(ScopedEnum): vals = ['none', 'transparent',
+                                                'hugetlb']
+class BackingStoreNumaPolicy(ScopedEnum): vals = ['none', 'interleave',
+                                                 'bind', 'preferred']
+
 if buildEnv['TARGET_ISA'] in ('sparc', 'power'):
     default_byte_order = 'big'
 else:
@@ -87,8 +92,34 @@ class System(SimObject):
         "use to directly address the backstore from another host-OS process. "
         "Leave this empty to unset the MAP_SHARED flag.")
 
+    # Memory stores in checkpoints are compressed by default. Stores
+    # written uncompressed can be restored lazily by mapping them
+    # copy-on-write, so that only the pages that are touched are read
+    # from the checkpoint.
+    compress_memory_checkpoints = Param.Bool(True, "Compress the memory "
+        "stores written to checkpoints")
+    lazy_memory_restore = Param.Bool(False, "Map uncompressed memory "
+        "stores copy-on-write instead of reading them when restoring "
+        "a checkpoint")
+
+    # Host memory policies of the backing store. Huge pages reduce the
+    # host TLB misses when accessing the simulated memory. hugetlb pages
+    # have to be reserved on the host, otherwise normal pages are used.
+    # With the bind and preferred NUMA policies, each backing store is
+    # placed on one of the NUMA nodes, in turn; with interleave, every
+    # store is spread over all of them.
+    backing_store_huge_pages = Param.BackingStoreHugePages('none',
+        "Host huge pages to use for the backing store")
+    backing_store_numa_policy = Param.BackingStoreNumaPolicy('none',
+        "Host NUMA policy of the backing store")
+    backing_store_numa_nodes = VectorParam.Unsigned([],
+        "Host NUMA nodes the NUMA policy applies to")
+
     cache_line_size = Param.Unsigned(64, "Cache line size in bytes")
 
+    bulk_functional_access = Param.Bool(True, "Let port proxies access "
+        "the backing store directly for lines that no cache holds")
+
     byte_order = Param.ByteOrder(default_byte_order,
                                  "Default byte order of system components")
 
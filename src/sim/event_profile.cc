@@ -0,0 +1,227 @@
+/*
+ * Copyright (c) 2026 The gem5 Authors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "sim/event_profile.hh"
+
+#include <algorithm>
+#include <iomanip>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <unordered_map>
+#include <vector>
+
+#include "base/cprintf.hh"
+#include "base/output.hh"
+#include "sim/core.hh"
+#include "sim/eventq.hh"
+
+namespace EventProfile {
+
+bool enabled = false;
+
+namespace {
+
+struct Record
+{
+    std::string name;
+    std::string description;
+    Entry entry;
+};
+
+/**
+ * Events are profiled by the thread servicing their queue, so every
+ * thread gets a table of its own and only reporting needs the lock.
+ */
+typedef std::unordered_map<std::string, Record> Table;
+
+std::mutex tablesLock;
+std::vector<std::unique_ptr<Table>> tables;
+__thread Table *localTable = nullptr;
+
+std::string reportFile;
+bool exitCallbackRegistered = false;
+
+Table &
+getTable()
+{
+    if (!localTable) {
+        std::lock_guard<std::mutex> lock(tablesLock);
+        tables.emplace_back(new Table);
+        localTable = tables.back().get();
+    }
+    return *localTable;
+}
+
+/** The SimObject owning an event named "system.cpu.tickEvent". */
+std::string
+owner(const std::string &name)
+{
+    auto pos = name.rfind('.');
+    return pos == std::string::npos ? "(none)" : name.substr(0, pos);
+}
+
+void
+printRow(std::ostream &os, const Entry &entry, uint64_t total,
+         const std::string &label)
+{
+    double pct = total ? 100.0 * entry.cycles / total : 0.0;
+    double avg = entry.count ? (double)entry.cycles / entry.count : 0.0;
+    ccprintf(os, "%16d %6.2f%% %12d %12.1f  %s\n",
+             entry.cycles, pct, entry.count, avg, label);
+}
+
+} // anonymous namespace
+
+Entry *
+lookup(const Event *event)
+{
+    const char *desc = event->description();
+    std::string name = event->name();
+
+    // Events that don't override name() are named after their
+    // address or instance number, which would give every instance an
+    // entry of its own. Group those by their description instead.
+    if (name.compare(0, 6, "Event_") == 0)
+        name = csprintf("(%s)", desc);
+
+    Record &rec = getTable()[name];
+    if (rec.name.empty()) {
+        rec.name = name;
+        rec.description = desc;
+    }
+    return &rec.entry;
+}
+
+void
+enable(const std::string &report_file)
+{
+    enabled = true;
+
+    if (report_file.empty())
+        return;
+
+    reportFile = report_file;
+    if (!exitCallbackRegistered) {
+        exitCallbackRegistered = true;
+        registerExitCallback([]() { dump(reportFile); });
+    }
+}
+
+void
+disable()
+{
+    enabled = false;
+}
+
+void
+reset()
+{
+    std::lock_guard<std::mutex> lock(tablesLock);
+    for (auto &table : tables)
+        table->clear();
+}
+
+void
+dump(std::ostream &os)
+{
+    std::lock_guard<std::mutex> lock(tablesLock);
+
+    // Merge the per-thread tables
+    std::map<std::string, Record> events;
+    for (auto &table : tables) {
+        for (auto &kv : *table) {
+            Record &rec = events[kv.first];
+            rec.name = kv.second.name;
+            rec.description = kv.second.description;
+            rec.entry.cycles += kv.second.entry.cycles;
+            rec.entry.count += kv.second.entry.count;
+        }
+    }
+
+    Entry total;
+    std::map<std::string, Entry> objects;
+    for (auto &kv : events) {
+        const Entry &e = kv.second.entry;
+        Entry &obj = objects[owner(kv.second.name)];
+        obj.cycles += e.cycles;
+        obj.count += e.count;
+        total.cycles += e.cycles;
+        total.count += e.count;
+    }
+
+    std::vector<const Record *> by_event;
+    for (auto &kv : events)
+        by_event.push_back(&kv.second);
+    std::stable_sort(by_event.begin(), by_event.end(),
+                     [](const Record *a, const Record *b) {
+                         return a->entry.cycles > b->entry.cycles;
+                     });
+
+    std::vector<std::pair<std::string, Entry>> by_object(
+        objects.begin(), objects.end());
+    std::stable_sort(by_object.begin(), by_object.end(),
+                     [](const std::pair<std::string, Entry> &a,
+                        const std::pair<std::string, Entry> &b) {
+                         return a.second.cycles > b.second.cycles;
+                     });
+
+#if defined(__x86_64__) || defined(__i386__)
+    const char *unit = "cycles";
+#else
+    const char *unit = "ns";
+#endif
+
+    ccprintf(os, "Event profile: %d host %s in %d events\n",
+             total.cycles, unit, total.count);
+
+    ccprintf(os, "\nBy object:\n");
+    ccprintf(os, "%16s %7s %12s %12s  %s\n", unit, "%", "events",
+             "avg", "object");
+    for (auto &obj : by_object)
+        printRow(os, obj.second, total.cycles, obj.first);
+
+    ccprintf(os, "\nBy event:\n");
+    ccprintf(os, "%16s %7s %12s %12s  %s\n", unit, "%", "events",
+             "avg", "event [description]");
+    for (auto *rec : by_event) {
+        printRow(os, rec->entry, total.cycles,
+                 csprintf("%s [%s]", rec->name, rec->description));
+    }
+}
+
+void
+dump(const std::string &filename)
+{
+    OutputStream *os = simout.create(filename);
+    dump(*os->stream());
+    simout.close(os);
+}
+
+} // namespace EventProfile
@@ -0,0 +1,118 @@
+/*
+ * Copyright (c) 2026 The gem5 Authors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * Host time profiling of event processing. When enabled, the event
+ * queues record how many host cycles are spent in each event's
+ * process() method, grouped by the name and description of the event
+ * and by the SimObject owning it.
+ */
+
+#ifndef __SIM_EVENT_PROFILE_HH__
+#define __SIM_EVENT_PROFILE_HH__
+
+#include <cstdint>
+#include <iosfwd>
+#include <string>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#else
+#include <chrono>
+#endif
+
+class Event;
+
+namespace EventProfile {
+
+/**
+ * Set while events are being profiled. This is checked by
+ * EventQueue::serviceOne() for every event, so it is a plain flag
+ * rather than anything more expensive to test.
+ */
+extern bool enabled;
+
+/** Accumulated host time and count of a class of events. */
+struct Entry
+{
+    uint64_t cycles = 0;
+    uint64_t count = 0;
+
+    void
+    sample(uint64_t c)
+    {
+        cycles += c;
+        count++;
+    }
+};
+
+/**
+ * Read the host's cycle counter. Hosts without an accessible cycle
+ * counter use a nanosecond clock instead.
+ */
+inline uint64_t
+now()
+{
+#if defined(__x86_64__) || defined(__i386__)
+    return __rdtsc();
+#else
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+#endif
+}
+
+/**
+ * Find the profile entry for an event. This has to be called before the
+ * event is processed since processing may delete it.
+ */
+Entry *lookup(const Event *event);
+
+/**
+ * Start profiling events.
+ *
+ * @param report_file If not empty, a report is written to this file in
+ *                    the output directory when gem5 exits.
+ */
+void enable(const std::string &report_file = "");
+
+/** Stop profiling events. The collected data is kept. */
+void disable();
+
+/** Discard all collected data. */
+void reset();
+
+/** Write a report sorted by host time to a stream. */
+void dump(std::ostream &os);
+
+/** Write a report sorted by host time to a file in the output directory. */
+void dump(const std::string &filename);
+
+} // namespace EventProfile
+
+#endif // __SIM_EVENT_PROFILE_HH__
@@ -41,6 +41,7 @@
 #include "cpu/smt.hh"
 #include "debug/Checkpoint.hh"
 #include "sim/core.hh"
+#include "sim/event_profile.hh"
 
 using namespace std;
 
@@ -219,7 +220,14 @@ EventQueue::serviceOne()
         setCurTick(event->when());
         if (DTRACE(Event))
             event->trace("executed");
-        event->process();
+        if (EventProfile::enabled) {
+            EventProfile::Entry *entry = EventProfile::lookup(event);
+            uint64_t start = EventProfile::now();
+            event->process();
+            entry->sample(EventProfile::now() - start);
+        } else {
+            event->process();
+        }
         if (event->isExitEvent()) {
             assert(!event->flags.isSet(Event::Managed) ||
                    !event->flags.isSet(Event::IsMainQueue)); // would be silly
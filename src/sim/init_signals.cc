@@ -56,6 +56,7 @@
 #include "base/atomicio.hh"
 #include "base/cprintf.hh"
 #include "base/logging.hh"
+#include "base/trace.hh"
 #include "sim/async.hh"
 #include "sim/backtrace.hh"
 #include "sim/core.hh"
@@ -152,6 +153,11 @@ abortHandler(int sigtype)
     }
 
     print_backtrace();
+
+    // Write out buffered debug output (e.g., the ring of a binary
+    // trace), which shows what led up to the abort.
+    Trace::getDebugLogger()->flush();
+
     raiseFatalSignal(sigtype);
 }
 
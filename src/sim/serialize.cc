@@ -45,6 +45,7 @@
 #include <sys/stat.h>
 #include <sys/time.h>
 #include <sys/types.h>
+#include <unistd.h>
 
 #include <cerrno>
 #include <fstream>
@@ -52,6 +53,7 @@
 #include <string>
 #include <vector>
 
+#include "base/binary_ini.hh"
 #include "base/inifile.hh"
 #include "base/output.hh"
 #include "base/trace.hh"
@@ -189,6 +191,11 @@ Serializable::serializeAll(const string &cpt_dir)
             fatal("couldn't mkdir %s\n", dir);
 
     string cpt_file = dir + CheckpointIn::baseFilename;
+
+    // Don't leave a binary form of an older checkpoint in this
+    // directory behind since it would be restored instead.
+    unlink((dir + CheckpointIn::binaryFilename).c_str());
+
     ofstream outstream(cpt_file.c_str());
     time_t t = time(NULL);
     if (!outstream.is_open())
@@ -244,6 +251,7 @@ Serializable::currentSection()
 }
 
 const char *CheckpointIn::baseFilename = "m5.cpt";
+const char *CheckpointIn::binaryFilename = "m5.cpt.bin";
 
 string CheckpointIn::currentDirectory;
 
@@ -266,9 +274,29 @@ CheckpointIn::dir()
 }
 
 CheckpointIn::CheckpointIn(const string &cpt_dir, SimObjectResolver &resolver)
-    : db(new IniFile), objNameResolver(resolver), _cptDir(setDir(cpt_dir))
+    : db(nullptr), binaryDb(nullptr), objNameResolver(resolver),
+      _cptDir(setDir(cpt_dir))
 {
     string filename = getCptDir() + "/" + CheckpointIn::baseFilename;
+    string bin_filename = getCptDir() + "/" + CheckpointIn::binaryFilename;
+
+    // Prefer the binary form of the checkpoint, unless it is older than
+    // the checkpoint, e.g., because the checkpoint has been upgraded.
+    struct stat cpt_stat, bin_stat;
+    if (stat(bin_filename.c_str(), &bin_stat) == 0) {
+        if (stat(filename.c_str(), &cpt_stat) == 0 &&
+            cpt_stat.st_mtime > bin_stat.st_mtime) {
+            warn("Ignoring '%s' since it is older than '%s'\n",
+                 bin_filename, filename);
+        } else {
+            binaryDb = new BinaryIniFile;
+            if (!binaryDb->load(bin_filename))
+                fatal("Can't load checkpoint file '%s'\n", bin_filename);
+            return;
+        }
+    }
+
+    db = new IniFile;
     if (!db->load(filename)) {
         fatal("Can't load checkpoint file '%s'\n", filename);
     }
@@ -277,7 +305,17 @@ CheckpointIn::CheckpointIn(const string &cpt_dir, SimObjectResolver &resolver)
 CheckpointIn::~CheckpointIn()
 {
     delete db;
+    delete binaryDb;
 }
+
+bool
+CheckpointIn::convertToBinary(const string &cpt_dir)
+{
+    string dir = cpt_dir + "/";
+    return BinaryIniFile::convert(dir + CheckpointIn::baseFilename,
+                                  dir + CheckpointIn::binaryFilename);
+}
+
 /**
  * @param section Here we mention the section we are looking for
  * (example: currentsection).
@@ -290,6 +328,8 @@ CheckpointIn::~CheckpointIn()
 bool
 CheckpointIn::entryExists(const string &section, const string &entry)
 {
+    if (binaryDb)
+        return binaryDb->entryExists(section, entry);
     return db->entryExists(section, entry);
 }
 /**
@@ -305,6 +345,8 @@ CheckpointIn::entryExists(const string &section, const string &entry)
 bool
 CheckpointIn::find(const string &section, const string &entry, string &value)
 {
+    if (binaryDb)
+        return binaryDb->find(section, entry, value);
     return db->find(section, entry, value);
 }
 /**
@@ -323,7 +365,7 @@ CheckpointIn::findObj(const string &section, const string &entry,
 {
     string path;
 
-    if (!db->find(section, entry, path))
+    if (!find(section, entry, path))
         return false;
 
     value = objNameResolver.resolveSimObject(path);
@@ -333,6 +375,8 @@ CheckpointIn::findObj(const string &section, const string &entry,
 bool
 CheckpointIn::sectionExists(const string &section)
 {
+    if (binaryDb)
+        return binaryDb->sectionExists(section);
     return db->sectionExists(section);
 }
 
@@ -58,6 +58,7 @@
 #include "base/logging.hh"
 #include "base/str.hh"
 
+class BinaryIniFile;
 class IniFile;
 class SimObject;
 class SimObjectResolver;
@@ -70,6 +71,9 @@ class CheckpointIn
 
     IniFile *db;
 
+    /** Indexed binary form of the checkpoint, used instead of db. */
+    BinaryIniFile *binaryDb;
+
     SimObjectResolver &objNameResolver;
 
     const std::string _cptDir;
@@ -96,6 +100,15 @@ class CheckpointIn
     bool sectionExists(const std::string &section);
     /** @}*/ //end of api_checkout group
 
+    /**
+     * Write the indexed binary form of the checkpoint in a directory,
+     * which is restored faster than the .ini form. It is used instead of
+     * the .ini form from then on, unless the .ini form is modified.
+     *
+     * @return True if successful, false on failure.
+     */
+    static bool convertToBinary(const std::string &cpt_dir);
+
     // The following static functions have to do with checkpoint
     // creation rather than restoration.  This class makes a handy
     // namespace for them though.  Currently no Checkpoint object is
@@ -133,6 +146,9 @@ class CheckpointIn
 
     // Filename for base checkpoint file within directory.
     static const char *baseFilename;
+
+    // Filename for the binary form of the base checkpoint file.
+    static const char *binaryFilename;
 };
 
 /**
@@ -61,6 +61,7 @@
 #include "debug/Quiesce.hh"
 #include "debug/WorkItems.hh"
 #include "mem/abstract_mem.hh"
+#include "mem/functional_data_holder.hh"
 #include "mem/physical.hh"
 #include "params/System.hh"
 #include "sim/byteswap.hh"
@@ -207,7 +208,7 @@ System::System(Params *p)
       multiThread(p->multi_thread),
       pagePtr(0),
       init_param(p->init_param),
-      physProxy(_systemPort, p->cache_line_size),
+      physProxy(_systemPort, p->cache_line_size, bulkAccessFunc()),
       workload(p->workload),
 #if USE_KVM
       kvmVM(p->kvm_vm),
@@ -215,7 +216,10 @@ System::System(Params *p)
       kvmVM(nullptr),
 #endif
       physmem(name() + ".physmem", p->memories, p->mmap_using_noreserve,
-              p->shared_backstore),
+              p->shared_backstore, p->compress_memory_checkpoints,
+              p->lazy_memory_restore, p->backing_store_huge_pages,
+              p->backing_store_numa_policy, p->backing_store_numa_nodes),
+      bulkFunctionalAccess(p->bulk_functional_access),
       memoryMode(p->mem_mode),
       _cacheLineSize(p->cache_line_size),
       workItemsBegin(0),
@@ -419,6 +423,26 @@ System::isMemAddr(Addr addr) const
     return physmem.isMemAddr(addr);
 }
 
+uint8_t *
+System::getBulkAccess(Addr addr, Addr size,
+                      std::vector<Addr> &held_lines) const
+{
+    if (!bulkFunctionalAccess)
+        return nullptr;
+
+    uint8_t *host_ptr = physmem.getHostPtr(addr, size);
+    if (!host_ptr)
+        return nullptr;
+
+    // caches are not used, hence memory holds the latest data
+    if (bypassCaches())
+        return host_ptr;
+
+    if (!FunctionalDataHolder::findAllHeldLines(addr, size, held_lines))
+        return nullptr;
+    return host_ptr;
+}
+
 void
 System::addDeviceMemory(RequestorID requestor_id, AbstractMemory *deviceMemory)
 {
@@ -341,6 +341,29 @@ class System : public SimObject, public PCEventScope
     /** Get a pointer to access the physical memory of the system */
     PhysicalMemory& getPhysMem() { return physmem; }
 
+    /**
+     * Force all functional accesses through the memory system, for
+     * memory systems holding data that cannot be queried.
+     */
+    void disableBulkFunctionalAccess() { bulkFunctionalAccess = false; }
+
+    /**
+     * Get direct access to the backing store of a range for a bulk
+     * functional access. @see PortProxy::BulkAccessFunc
+     */
+    uint8_t *getBulkAccess(Addr addr, Addr size,
+                           std::vector<Addr> &held_lines) const;
+
+    /** Get the bulk access function to hand to port proxies. */
+    PortProxy::BulkAccessFunc
+    bulkAccessFunc() const
+    {
+        return [this](Addr addr, Addr size, std::vector<Addr> &held_lines)
+        {
+            return getBulkAccess(addr, size, held_lines);
+        };
+    }
+
     /** Amount of physical memory that is still free */
     Addr freeMemSize() const;
 
@@ -411,6 +434,9 @@ class System : public SimObject, public PCEventScope
 
     PhysicalMemory physmem;
 
+    /** Whether port proxies may access the backing store directly. */
+    bool bulkFunctionalAccess;
+
     Enums::MemoryMode memoryMode;
 
     const unsigned int _cacheLineSize;
@@ -42,6 +42,7 @@ parser = argparse.ArgumentParser(description='Simple memory tester')
 parser.add_argument('--bandwidth', default=None)
 parser.add_argument('--latency', default=None)
 parser.add_argument('--latency_var', default=None)
+parser.add_argument('--tgen-config', default='tgen-simple-mem.cfg')
 
 args = parser.parse_args()
 
@@ -50,7 +51,7 @@ args = parser.parse_args()
 try:
     cpu = TrafficGen(
         config_file=os.path.join(os.path.dirname(os.path.abspath(__file__)),
-                             "tgen-simple-mem.cfg"))
+                             args.tgen_config))
 except NameError:
     m5.fatal("protobuf required for simple memory test")
 
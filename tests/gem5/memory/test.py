@@ -60,6 +60,14 @@ for name, params in simple_mem_params:
         valid_isas=(constants.null_tag,),
         ) # This tests for validity as well as performance
 
+gem5_verify_config(
+    name='simple_mem_binary_trace',
+    verifiers=(), # No need for verfiers this will return non-zero on fail
+    config=joinpath(getcwd(), 'simple-run.py'),
+    config_args = ['--tgen-config=tgen-binary-trace.cfg'],
+    valid_isas=(constants.null_tag,),
+)
+
 gem5_verify_config(
     name='memtest',
     verifiers=(), # No need for verfiers this will return non-zero on fail
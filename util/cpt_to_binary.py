@@ -0,0 +1,57 @@
+# Copyright (c) 2026 The gem5 Authors
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are
+# met: redistributions of source code must retain the above copyright
+# notice, this list of conditions and the following disclaimer;
+# redistributions in binary form must reproduce the above copyright
+# notice, this list of conditions and the following disclaimer in the
+# documentation and/or other materials provided with the distribution;
+# neither the name of the copyright holders nor the names of its
+# contributors may be used to endorse or promote products derived from
+# this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+# A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+# OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+# SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+# LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+# THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+# Convert checkpoints to the indexed binary form, which is restored
+# much faster than the .ini form for large systems. The binary form is
+# written next to the original as m5.cpt.bin and is used when restoring
+# the checkpoint from then on. This script runs inside gem5:
+#
+#   build/X86/gem5.opt util/cpt_to_binary.py <checkpoint dir>...
+#
+# Checkpoints upgraded with util/cpt_upgrader.py need to be converted
+# again; until then the .ini form is restored.
+
+from __future__ import print_function
+
+import os
+import sys
+
+from m5 import core
+
+if len(sys.argv) < 2:
+    print("Usage: %s <checkpoint dir>..." % sys.argv[0], file=sys.stderr)
+    sys.exit(1)
+
+failed = False
+for cpt_dir in sys.argv[1:]:
+    if not os.path.isfile(os.path.join(cpt_dir, "m5.cpt")):
+        print("%s: no m5.cpt found" % cpt_dir, file=sys.stderr)
+        failed = True
+    elif not core.convertCheckpoint(cpt_dir):
+        print("%s: conversion failed" % cpt_dir, file=sys.stderr)
+        failed = True
+
+sys.exit(1 if failed else 0)
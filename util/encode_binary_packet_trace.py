@@ -0,0 +1,105 @@
+#!/usr/bin/env python2.7
+
+# Copyright (c) 2026 The gem5 Authors
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are
+# met: redistributions of source code must retain the above copyright
+# notice, this list of conditions and the following disclaimer;
+# redistributions in binary form must reproduce the above copyright
+# notice, this list of conditions and the following disclaimer in the
+# documentation and/or other materials provided with the distribution;
+# neither the name of the copyright holders nor the names of its
+# contributors may be used to endorse or promote products derived from
+# this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+# A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+# OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+# SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+# LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+# THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+# This script converts a protobuf packet trace into the binary packet
+# trace format replayed by the BinaryTraceGen traffic generator. The
+# binary trace consists of a header followed by fixed-size records, all
+# in the byte order of the host running this script:
+#
+# header: char magic[8] = "gem5bpt\0", uint32 version, uint32 record
+#         size, uint64 tick frequency, uint64 number of records
+# record: uint64 tick, uint64 addr, uint64 flags, uint32 size, uint32 cmd
+
+from __future__ import print_function
+
+import os
+import protolib
+import struct
+import subprocess
+import sys
+
+util_dir = os.path.dirname(os.path.realpath(__file__))
+# Make sure the proto definitions are up to date.
+subprocess.check_call(['make', '--quiet', '-C', util_dir, 'packet_pb2.py'])
+import packet_pb2
+
+header_format = '=8sIIQQ'
+record_format = '=QQQII'
+
+def main():
+    if len(sys.argv) != 3:
+        print("Usage: ", sys.argv[0], " <protobuf input> <binary output>")
+        exit(-1)
+
+    # Open the file in read mode
+    proto_in = protolib.openFileRd(sys.argv[1])
+
+    try:
+        binary_out = open(sys.argv[2], 'wb')
+    except IOError:
+        print("Failed to open ", sys.argv[2], " for writing")
+        exit(-1)
+
+    # Read the magic number in 4-byte Little Endian
+    magic_number = proto_in.read(4)
+
+    if magic_number != b"gem5":
+        print("Unrecognized file", sys.argv[1])
+        exit(-1)
+
+    header = packet_pb2.PacketHeader()
+    protolib.decodeMessage(proto_in, header)
+
+    # The number of records is filled in once they have been written
+    binary_out.write(struct.pack(header_format, b"gem5bpt\0", 1,
+                                 struct.calcsize(record_format),
+                                 header.tick_freq, 0))
+
+    num_packets = 0
+    packet = packet_pb2.Packet()
+
+    # Decode the packet messages until we hit the end of the file
+    while protolib.decodeMessage(proto_in, packet):
+        num_packets += 1
+        flags = packet.flags if packet.HasField('flags') else 0
+        binary_out.write(struct.pack(record_format, packet.tick, packet.addr,
+                                     flags, packet.size, packet.cmd))
+
+    binary_out.seek(0)
+    binary_out.write(struct.pack(header_format, b"gem5bpt\0", 1,
+                                 struct.calcsize(record_format),
+                                 header.tick_freq, num_packets))
+
+    print("Converted packets:", num_packets)
+
+    # We're done
+    binary_out.close()
+    proto_in.close()
+
+if __name__ == "__main__":
+    main()